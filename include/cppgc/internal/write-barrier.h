@@ -464,6 +464,14 @@ void WriteBarrier::GenerationalBarrier(const Params& params, const void* slot) {
   if (V8_LIKELY(age_table.GetAge(params.slot_offset) == AgeTable::Age::kYoung))
     return;
 
+  // Bail out if a precise slot refers to an old object. Only old-to-young
+  // references need to be remembered.
+  if constexpr (type != GenerationalBarrierType::kImpreciseSlot) {
+    if (params.value_offset > 0 &&
+        age_table.GetAge(params.value_offset) == AgeTable::Age::kOld)
+      return;
+  }
+
   // Dispatch between different types of barriers.
   // TODO(chromium:1029379): Consider reload local_data in the slow path to
   // reduce register pressure.
@@ -0,0 +1,116 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_CODE_CACHE_STORE_H_
+#define V8_LIBPLATFORM_CODE_CACHE_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "libplatform/libplatform-export.h"
+
+namespace v8 {
+
+class Platform;
+
+namespace platform {
+
+/**
+ * A persistent store for the code caches produced by
+ * v8::ScriptCompiler::CreateCodeCache, backed by one file per script in a
+ * directory.
+ *
+ * Typical use:
+ *
+ *   CodeCacheStore::Key key{
+ *       CodeCacheStore::HashSource(source_bytes, source_size),
+ *       source_size, v8::ScriptCompiler::CachedDataVersionTag()};
+ *   if (auto entry = store->Lookup(key)) {
+ *     // Deserialize on a background thread, e.g. with
+ *     // v8::ScriptCompiler::StartConsumingCodeCache, from a CachedData with
+ *     // BufferNotOwned that points into |entry|. If the cache is rejected,
+ *     // call store->Remove(key).
+ *   } else {
+ *     // Compile, then
+ *     store->Store(key, cached_data->data, cached_data->length);
+ *   }
+ *
+ * Code caches are only valid for the V8 version, flags and CPU features they
+ * were produced with, which is why the key contains the version tag. Entries
+ * for other version tags are simply never looked up again. V8 also verifies
+ * the cache against the source and flags when consuming it, so a store that
+ * has been tampered with or corrupted leads to rejected caches, not to
+ * incorrect behavior.
+ *
+ * All methods are thread-safe.
+ */
+class V8_PLATFORM_EXPORT CodeCacheStore {
+ public:
+  struct Key {
+    // See HashSource.
+    uint64_t source_hash;
+    // The length of the source, as an additional guard against collisions.
+    uint32_t source_length;
+    // v8::ScriptCompiler::CachedDataVersionTag().
+    uint32_t version_tag;
+  };
+
+  /**
+   * A code cache that was read from the store. The data is memory-mapped from
+   * its file and stays valid as long as the Entry is alive.
+   */
+  class Entry {
+   public:
+    virtual ~Entry() = default;
+    virtual const uint8_t* data() const = 0;
+    virtual size_t length() const = 0;
+  };
+
+  virtual ~CodeCacheStore() = default;
+
+  /**
+   * Hashes |length| bytes of source text, e.g. the contents of a one-byte or
+   * two-byte v8::String, or its UTF-8 encoding. Embedders must of course use
+   * the same encoding for storing and looking up a script.
+   */
+  static uint64_t HashSource(const void* data, size_t length);
+
+  /**
+   * Returns the entry for |key|, or nullptr if there is none.
+   */
+  virtual std::unique_ptr<Entry> Lookup(const Key& key) = 0;
+
+  /**
+   * Copies |data| and writes it to the store on a worker thread. Concurrent
+   * writers of the same key (also in other processes) are fine: each entry is
+   * written to a temporary file first, and then renamed into place.
+   */
+  virtual void Store(const Key& key, const uint8_t* data, size_t length) = 0;
+
+  /**
+   * Removes the entry for |key|, e.g. after V8 rejected it.
+   */
+  virtual void Remove(const Key& key) = 0;
+
+  /**
+   * Blocks until all writes started by Store() have finished. Also happens
+   * when the store is destroyed.
+   */
+  virtual void WaitForPendingWrites() = 0;
+};
+
+/**
+ * Returns a new CodeCacheStore that keeps its files in |directory|, which
+ * must exist, and uses the worker threads of |platform| for writing them.
+ * |platform| must outlive the store.
+ */
+V8_PLATFORM_EXPORT std::unique_ptr<CodeCacheStore> NewCodeCacheStore(
+    v8::Platform* platform, const char* directory);
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_CODE_CACHE_STORE_H_
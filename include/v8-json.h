@@ -5,12 +5,17 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
 class Value;
 class String;
 
@@ -40,6 +45,41 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Parses UTF-8 encoded JSON text that arrives in chunks, e.g. from the
+   * network, without first assembling it into a single string. The embedder
+   * is free to return to the event loop between chunks.
+   *
+   * Once Write() or Finish() has failed, all further calls fail with the same
+   * exception.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    explicit StreamingParser(Isolate* isolate);
+    ~StreamingParser();
+
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Consumes the next |length| bytes of input. Chunk boundaries may fall
+     * anywhere, including in the middle of a token or of a UTF-8 sequence.
+     * Throws a SyntaxError as soon as the input can no longer be valid JSON.
+     */
+    V8_WARN_UNUSED_RESULT Maybe<bool> Write(Local<Context> context,
+                                            const uint8_t* data,
+                                            size_t length);
+
+    /**
+     * Signals the end of the input and returns the parsed value.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 }  // namespace v8
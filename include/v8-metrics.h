@@ -97,6 +97,17 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+// Reported after full GC cycles when --gc-pause-target is enabled. Covers the
+// main thread GC pauses and steps since the previous report.
+struct GarbageCollectionMutatorUtilization {
+  // The share of every window that should be left to the mutator.
+  double target_in_percent = -1.0;
+  // The lowest share that was actually left to the mutator in any window.
+  double minimum_in_percent = -1.0;
+  // How many pauses ended a window in which the target was missed.
+  int64_t windows_below_target = -1;
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -205,6 +216,7 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionMutatorUtilization)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
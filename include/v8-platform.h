@@ -498,6 +498,15 @@ class PageAllocator {
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 
+  /**
+   * Hints the OS that the memory in the given [address, address + size) range
+   * should be backed by huge pages (e.g. transparent huge pages on Linux),
+   * which reduces TLB misses for large heaps. Only the parts of the range that
+   * are aligned to the huge page size can be backed by huge pages. Returns
+   * true if the hint was given, false if huge pages are not supported.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
+
   /**
    * Decommits any wired memory pages in the given range, allowing the OS to
    * reclaim them, and marks the region as inacessible (kNoAccess). The address
@@ -8,6 +8,7 @@
 #include <limits.h>
 
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -631,7 +632,8 @@ class V8_EXPORT HeapGraphNode {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -681,6 +683,26 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format is a more compact alternative for tools that process
+   * snapshots automatically. It contains the same nodes, edges and locations
+   * as the JSON format, but no allocation traces or samples. The chunks are
+   * passed to OutputStream::WriteAsciiChunk but contain arbitrary bytes. All
+   * numbers are unsigned LEB128 varints, except where noted:
+   *
+   *   "V8HS" (4 bytes), format version (currently 1)
+   *   string_count, then for each string: its UTF-8 length and bytes
+   *   node_count, then for each node:
+   *     type, name (string index), id (zigzag-encoded difference to the id
+   *     of the previous node, or to 0 for the first node), self_size,
+   *     edge_count, trace_node_id, detachedness
+   *   edge_count, then the edges of all nodes in node order:
+   *     type, name_or_index (string index for named edges), to_node (node
+   *     index)
+   *   location_count, then for each location:
+   *     node index, script_id, line, column
+   *
+   * Strings are not guaranteed to be unique in the string table.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -69,6 +69,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -3456,6 +3457,36 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  explicit PrivateData(i::Isolate* i) : parser(i) {}
+  i::JsonStreamingParser parser;
+};
+
+JSON::StreamingParser::StreamingParser(Isolate* v8_isolate)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(v8_isolate))) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+Maybe<bool> JSON::StreamingParser::Write(Local<Context> context,
+                                         const uint8_t* data, size_t length) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StreamingWrite, Nothing<bool>(),
+           i::HandleScope);
+  Maybe<bool> result =
+      private_->parser.Write(base::Vector<const uint8_t>(data, length));
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, StreamingFinish, Value);
+  Local<Value> result;
+  has_pending_exception = !ToLocal(private_->parser.Finish(), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -11206,10 +11237,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11655,7 +11692,7 @@ void InvokeFunctionCallbackOptimized(
 void InvokeFinalizationRegistryCleanupFromTask(
     Handle<NativeContext> native_context,
     Handle<JSFinalizationRegistry> finalization_registry,
-    Handle<Object> callback) {
+    Handle<Object> callback, base::TimeTicks deadline) {
   i::Isolate* i_isolate = finalization_registry->native_context()->GetIsolate();
   RCS_SCOPE(i_isolate,
             RuntimeCallCounterId::kFinalizationRegistryCleanupFromTask);
@@ -11667,13 +11704,34 @@ void InvokeFinalizationRegistryCleanupFromTask(
   Local<v8::Context> api_context = Utils::ToLocal(native_context);
   CallDepthScope<true> call_depth_scope(i_isolate, api_context);
   VMState<OTHER> state(i_isolate);
-  Handle<Object> argv[] = {callback};
-  if (Execution::CallBuiltin(i_isolate,
-                             i_isolate->finalization_registry_cleanup_some(),
-                             finalization_registry, arraysize(argv), argv)
-          .is_null()) {
-    call_depth_scope.Escape();
+  if (deadline.IsNull()) {
+    Handle<Object> argv[] = {callback};
+    if (Execution::CallBuiltin(i_isolate,
+                               i_isolate->finalization_registry_cleanup_some(),
+                               finalization_registry, arraysize(argv), argv)
+            .is_null()) {
+      call_depth_scope.Escape();
+    }
+    return;
+  }
+  // Same as the cleanupSome builtin, but checks the deadline after each
+  // callback.
+  bool has_exception = false;
+  while (finalization_registry->NeedsCleanup()) {
+    HandleScope handle_scope(i_isolate);
+    Handle<Object> holdings = JSFinalizationRegistry::PopClearedCellHoldings(
+        finalization_registry, i_isolate);
+    if (Execution::Call(i_isolate, callback,
+                        i_isolate->factory()->undefined_value(), 1, &holdings)
+            .is_null()) {
+      has_exception = true;
+      break;
+    }
+    if (base::TimeTicks::Now() >= deadline) break;
   }
+  JSFinalizationRegistry::ShrinkUnregisterTokenMap(finalization_registry,
+                                                   i_isolate);
+  if (has_exception) call_depth_scope.Escape();
 }
 
 template <>
@@ -13,6 +13,7 @@
 #include "include/v8-proxy.h"
 #include "include/v8-typed-array.h"
 #include "include/v8-wasm.h"
+#include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/objects/bigint.h"
 #include "src/objects/contexts.h"
@@ -507,10 +508,13 @@ void InvokeFunctionCallbackGeneric(
 void InvokeFunctionCallbackOptimized(
     const v8::FunctionCallbackInfo<v8::Value>& info);
 
+// Calls the cleanup callback for the cleared cells of |finalization_registry|.
+// Stops after the first callback that returns after |deadline|, unless the
+// deadline is null.
 void InvokeFinalizationRegistryCleanupFromTask(
     Handle<NativeContext> native_context,
     Handle<JSFinalizationRegistry> finalization_registry,
-    Handle<Object> callback);
+    Handle<Object> callback, base::TimeTicks deadline);
 
 template <typename T>
 EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
@@ -105,6 +105,8 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool AdviseHugePages(void* address, size_t size) override;
+
   bool DecommitPages(void* address, size_t size) override;
 
  private:
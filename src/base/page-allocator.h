@@ -50,6 +50,8 @@ class V8_BASE_EXPORT PageAllocator
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool AdviseHugePages(void* address, size_t size) override;
+
   bool DecommitPages(void* address, size_t size) override;
 
  private:
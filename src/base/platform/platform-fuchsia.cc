@@ -309,6 +309,9 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
                                     address, size);
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::DecommitPages(void* address, size_t size) {
   // We rely on DiscardSystemPages decommitting the pages immediately (via
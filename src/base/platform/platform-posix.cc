@@ -604,6 +604,16 @@ bool OS::DecommitPages(void* address, size_t size) {
 }
 #endif  // !defined(_AIX)
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if defined(MADV_HUGEPAGE)
+  // This is advisory, and fails e.g. if transparent huge pages are disabled.
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif  // defined(MADV_HUGEPAGE)
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
@@ -489,6 +489,9 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 Stack::StackSlot Stack::GetCurrentStackPosition() {
   void* addresses[kStackSize];
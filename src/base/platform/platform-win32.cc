@@ -1069,6 +1069,13 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows have to be allocated with MEM_LARGE_PAGES up front,
+  // which requires a privilege that is usually not granted.
+  return false;
+}
+
 // static
 bool OS::DecommitPages(void* address, size_t size) {
   DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
@@ -26,6 +26,40 @@ Status ProcessorImpl::get_and_clear_status() {
   return result;
 }
 
+namespace {
+
+// The Platform of the ProcessorImpls that run parallel work items. It doesn't
+// offer worker threads of its own, so nested work isn't split any further.
+class ParallelWorkPlatform final : public Platform {
+ public:
+  explicit ParallelWorkPlatform(ParallelWorkScope* scope) : scope_(scope) {}
+
+  bool InterruptRequested() override { return scope_->InterruptRequested(); }
+
+ private:
+  ParallelWorkScope* scope_;
+};
+
+}  // namespace
+
+void ParallelWorkScope::Run(int index) {
+  if (interrupted()) return;
+  ProcessorImpl processor(new ParallelWorkPlatform(this));
+  RunItem(&processor, index);
+  if (processor.should_terminate()) {
+    interrupted_.store(true, std::memory_order_relaxed);
+  }
+}
+
+bool ParallelWorkScope::InterruptRequested() {
+  if (interrupted()) return true;
+  // The embedder's Platform expects to be queried on the calling thread only.
+  if (std::this_thread::get_id() != calling_thread_) return false;
+  if (!platform_->InterruptRequested()) return false;
+  interrupted_.store(true, std::memory_order_relaxed);
+  return true;
+}
+
 Processor* Processor::New(Platform* platform) {
   ProcessorImpl* impl = new ProcessorImpl(platform);
   return static_cast<Processor*>(impl);
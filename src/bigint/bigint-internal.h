@@ -5,7 +5,9 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "src/bigint/bigint.h"
 
@@ -16,6 +18,13 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Minimum X.len() + Y.len() for distributing an FFT multiplication's work
+// over the Platform's worker threads; below that, waking up the workers
+// costs more than they save.
+constexpr int kFftParallelThreshold = 8000;
+// Number of items per thread to split parallel work into, so that threads
+// which are slow to start or get preempted don't hold up the others.
+constexpr int kParallelItemsPerThread = 4;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
@@ -24,6 +33,33 @@ constexpr int kNewtonInversionThreshold = 50;
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
 
+class ProcessorImpl;
+
+// State shared by all items of one {ProcessorImpl::ParallelFor} invocation.
+// Every item runs on its own ProcessorImpl, whose interrupt checks end up in
+// {InterruptRequested} below: only the thread that called {ParallelFor} asks
+// the embedder's Platform, and once an interrupt has been observed, all items
+// see it and bail out.
+class ParallelWorkScope : public Platform::ParallelWork {
+ public:
+  explicit ParallelWorkScope(Platform* platform)
+      : platform_(platform), calling_thread_(std::this_thread::get_id()) {}
+
+  void Run(int index) final;
+  bool InterruptRequested();
+  bool interrupted() const {
+    return interrupted_.load(std::memory_order_relaxed);
+  }
+
+ protected:
+  virtual void RunItem(ProcessorImpl* processor, int index) = 0;
+
+ private:
+  Platform* platform_;
+  const std::thread::id calling_thread_;
+  std::atomic<bool> interrupted_{false};
+};
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -75,6 +111,22 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  // Returns true if work on inputs of combined length {len} should be
+  // distributed over worker threads.
+  bool should_parallelize(int len, int threshold) {
+    return len >= threshold && platform_->NumberOfWorkerThreads() > 0;
+  }
+  // The number of items to split parallel work into.
+  int parallel_items() {
+    return (platform_->NumberOfWorkerThreads() + 1) * kParallelItemsPerThread;
+  }
+
+  // Calls {work(processor, index)} for each index in [0, count), possibly
+  // concurrently. Each call gets its own {processor}, which it must use for
+  // all nested operations instead of this one.
+  template <typename Work>
+  void ParallelFor(int count, Work work);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -98,6 +150,25 @@ class ProcessorImpl : public Processor {
   Platform* platform_;
 };
 
+template <typename Work>
+void ProcessorImpl::ParallelFor(int count, Work work) {
+  class Scope final : public ParallelWorkScope {
+   public:
+    Scope(Platform* platform, Work* work)
+        : ParallelWorkScope(platform), work_(work) {}
+
+   private:
+    void RunItem(ProcessorImpl* processor, int index) override {
+      (*work_)(processor, index);
+    }
+
+    Work* work_;
+  };
+  Scope scope(platform_, &work);
+  platform_->RunInParallel(&scope, count);
+  if (scope.interrupted()) status_ = Status::kInterrupted;
+}
+
 // These constants are primarily needed for Barrett division in div-barrett.cc,
 // and they're also needed by fast to-string conversion in tostring.cc.
 constexpr int DivideBarrettScratchSpace(int n) { return n + 2; }
@@ -189,8 +189,28 @@ class Platform {
 
   // If you want the ability to interrupt long-running operations, implement
   // a Platform subclass that overrides this method. It will be queried
-  // every now and then by long-running operations.
+  // every now and then by long-running operations. It is only ever called
+  // on the thread that invoked the {Processor}.
   virtual bool InterruptRequested() { return false; }
+
+  // Operations on very large inputs can split some of their work into
+  // independent items. A {ParallelWork} item may be processed on any thread.
+  class ParallelWork {
+   public:
+    virtual ~ParallelWork() = default;
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want operations on very large inputs to use more than one thread,
+  // override these methods: {RunInParallel} must call {work->Run(i)} exactly
+  // once for each i in [0, count), and must not return before all of these
+  // calls have returned. {NumberOfWorkerThreads} tells the library how many
+  // threads besides the calling one can help, so it can split work
+  // accordingly; if it is 0, work is not split.
+  virtual int NumberOfWorkerThreads() { return 0; }
+  virtual void RunInParallel(ParallelWork* work, int count) {
+    for (int i = 0; i < count; i++) work->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
@@ -133,6 +133,9 @@ void BZ::D3n2n(RWDigits Q, RWDigits R, Digits A1A2, Digits A3, Digits B) {
     r1_high += AddAndReturnCarry(R1, A2, B1);
   }
   // 4. Compute D = Qhat * B2 using (Karatsuba) multiplication.
+  //    This is the only step that can use worker threads: for very large n,
+  //    the FFT multiplication distributes its work over them. Everything else
+  //    depends on the remainder of the previous step.
   RWDigits D(scratch_mem_.get(), 2 * n);
   proc_->Multiply(D, Qhat, B2);
   if (proc_->should_terminate()) return;
@@ -59,6 +59,9 @@ void ProcessorImpl::FromStringClassic(RWDigits Z,
 //   just copy the previous result. (In theory we could even de-dupe them, but
 //   as the parts/multipliers grow, we'll need most of the memory anyway.)
 //   Copied results are marked with a * below.
+// - The one multiplier that does get computed on each level is the square of
+//   the previous level's, which FFT multiplication computes with one forward
+//   transform instead of two.
 // - We can re-use memory using a system of three buffers whose usage rotates:
 //   - one is considered empty, and is overwritten with the new parts,
 //   - one holds the multipliers (and will be "empty" in the next round), and
@@ -177,7 +180,14 @@ void ProcessorImpl::FromStringLarge(RWDigits Z,
           }
         }
         if (!copied) {
-          Multiply(m_out, m_in, m_in2);
+          // Apart from the last one, all multipliers are the same power of
+          // the radix. Pass the same vector twice to let the multiplication
+          // take advantage of squaring.
+          if (Compare(m_in, m_in2) == 0) {
+            Multiply(m_out, m_in, m_in);
+          } else {
+            Multiply(m_out, m_in, m_in2);
+          }
           if (should_terminate()) return;
         }
       }
@@ -461,9 +461,9 @@ class FFTContainer {
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
 
-  void PointwiseMultiply(const FFTContainer& other);
+  void PointwiseMultiply(const FFTContainer& other, bool parallel = false);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -721,8 +721,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +733,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -748,9 +748,24 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 }
 
 // Convenient entry point for pointwise multiplications.
-void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
+// With {parallel}, the parts are split into ranges that are processed
+// concurrently; each of them needs its own temporary storage.
+void FFTContainer::PointwiseMultiply(const FFTContainer& other, bool parallel) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  if (!parallel) {
+    return DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+  }
+  // The ranges must consist of pairs of parts, because of the first level of
+  // the backwards FFT that DoPointwiseMultiplication performs.
+  DCHECK((n_ & 1) == 0);
+  int pairs = n_ / 2;
+  int items = std::min(pairs, processor_->parallel_items());
+  processor_->ParallelFor(items, [&](ProcessorImpl* processor, int item) {
+    int start = 2 * (pairs * item / items);
+    int end = 2 * (pairs * (item + 1) / items);
+    std::unique_ptr<digit_t[]> temp(new digit_t[length_ * 2]);
+    DoPointwiseMultiplication(other, start, end, temp.get(), processor);
+  });
 }
 
 }  // namespace
@@ -769,15 +784,33 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int m = GetParameters(X.len() + Y.len(), &params);
   int omega = params.r;  // really: 2^r
 
+  // For very large inputs, distribute the two forward transforms and the
+  // pointwise multiplications over worker threads. The backwards transform
+  // and recombination are comparatively cheap and stay on this thread.
+  bool parallel = should_parallelize(X.len() + Y.len(), kFftParallelThreshold);
+
   FFTContainer a(params.n, params.K, this);
-  a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
-    a.PointwiseMultiply(a);
+    a.Start(X, params.s, 0, omega);
+    a.PointwiseMultiply(a, parallel);
   } else {
     FFTContainer b(params.n, params.K, this);
-    b.Start(Y, params.s, 0, omega);
-    a.PointwiseMultiply(b);
+    if (parallel) {
+      // The forward transforms only use their own container's storage.
+      ParallelFor(2, [&](ProcessorImpl* processor, int index) {
+        if (index == 0) {
+          a.Start(X, params.s, 0, omega);
+        } else {
+          b.Start(Y, params.s, 0, omega);
+        }
+      });
+      if (should_terminate()) return;
+    } else {
+      a.Start(X, params.s, 0, omega);
+      b.Start(Y, params.s, 0, omega);
+    }
+    a.PointwiseMultiply(b, parallel);
   }
   if (should_terminate()) return;
 
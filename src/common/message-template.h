@@ -553,6 +553,8 @@ namespace internal {
     "Unexpected token '%', ...\"%\" is not valid JSON")                        \
   T(JsonParseUnexpectedTokenStartStringWithContext,                            \
     "Unexpected token '%', \"%\"... is not valid JSON")                        \
+  T(JsonParseUnexpectedCharacter,                                              \
+    "Unexpected character in JSON at position % (line % column %)")            \
   T(LabelRedeclaration, "Label '%' has already been declared")                 \
   T(LabelledFunctionDeclaration,                                               \
     "Labelled function declaration not allowed as the body of a control flow " \
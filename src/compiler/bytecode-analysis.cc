@@ -1106,6 +1106,58 @@ bool BytecodeAnalysis::LivenessIsValid() {
 }
 #endif
 
+struct BytecodeAnalysisCache::Entry {
+  explicit Entry(AccountingAllocator* allocator)
+      : zone(allocator, "BytecodeAnalysisCache") {}
+
+  Zone zone;
+  BytecodeAnalysis* analysis = nullptr;
+};
+
+BytecodeAnalysisCache::BytecodeAnalysisCache(AccountingAllocator* allocator)
+    : allocator_(allocator) {}
+
+BytecodeAnalysisCache::~BytecodeAnalysisCache() = default;
+
+std::shared_ptr<const BytecodeAnalysis> BytecodeAnalysisCache::Get(
+    Handle<BytecodeArray> bytecode_array, BytecodeOffset osr_bailout_id,
+    bool analyze_liveness, int gc_epoch) {
+  const Address key = bytecode_array->address();
+  {
+    base::MutexGuard guard(&mutex_);
+    if (gc_epoch > gc_epoch_) {
+      // The cached bytecode arrays may have been moved or freed since.
+      entries_.clear();
+      gc_epoch_ = gc_epoch;
+    }
+    auto it = gc_epoch == gc_epoch_ ? entries_.find(key) : entries_.end();
+    if (it != entries_.end() &&
+        it->second->analysis->Subsumes(osr_bailout_id, analyze_liveness)) {
+      return std::shared_ptr<const BytecodeAnalysis>(it->second,
+                                                     it->second->analysis);
+    }
+  }
+
+  // Analyze outside of the lock, at the risk of doing it twice when several
+  // jobs ask for the same bytecode at the same time.
+  auto entry = std::make_shared<Entry>(allocator_);
+  entry->analysis = entry->zone.New<BytecodeAnalysis>(
+      bytecode_array, &entry->zone, osr_bailout_id, analyze_liveness);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (gc_epoch == gc_epoch_) {
+      if (entries_.size() >= kMaxEntries) entries_.clear();
+      entries_[key] = entry;
+    }
+  }
+  return std::shared_ptr<const BytecodeAnalysis>(entry, entry->analysis);
+}
+
+size_t BytecodeAnalysisCache::size_for_testing() {
+  base::MutexGuard guard(&mutex_);
+  return entries_.size();
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,10 @@
 #ifndef V8_COMPILER_BYTECODE_ANALYSIS_H_
 #define V8_COMPILER_BYTECODE_ANALYSIS_H_
 
+#include <memory>
+#include <unordered_map>
+
+#include "src/base/platform/mutex.h"
 #include "src/compiler/bytecode-liveness-map.h"
 #include "src/handles/handles.h"
 #include "src/interpreter/bytecode-register.h"
@@ -15,6 +19,7 @@
 namespace v8 {
 namespace internal {
 
+class AccountingAllocator;
 class BytecodeArray;
 
 namespace compiler {
@@ -155,6 +160,13 @@ class V8_EXPORT_PRIVATE BytecodeAnalysis : public ZoneObject {
   // Return whether liveness analysis was performed (for verification purposes).
   bool liveness_analyzed() const { return analyze_liveness_; }
 
+  // Return whether this analysis can be used where one for {osr_bailout_id}
+  // and {analyze_liveness} was asked for.
+  bool Subsumes(BytecodeOffset osr_bailout_id, bool analyze_liveness) const {
+    return (osr_bailout_id == osr_bailout_id_ || osr_bailout_id.IsNone()) &&
+           analyze_liveness == analyze_liveness_;
+  }
+
   // Return the number of bytecodes (i.e. the number of bytecode operations, as
   // opposed to the number of bytes in the bytecode).
   int bytecode_count() const { return bytecode_count_; }
@@ -205,6 +217,42 @@ class V8_EXPORT_PRIVATE BytecodeAnalysis : public ZoneObject {
   int bytecode_count_;
 };
 
+// Shares bytecode analyses between the compilation jobs of an isolate, so that
+// e.g. Turbofan doesn't redo the analysis Maglev did for the same bytecode.
+// Can be used from any thread. Analyses are keyed by the address of their
+// bytecode array, which is stable between full GCs, and are dropped when
+// a full GC happened since they were computed.
+class V8_EXPORT_PRIVATE BytecodeAnalysisCache final {
+ public:
+  explicit BytecodeAnalysisCache(AccountingAllocator* allocator);
+  ~BytecodeAnalysisCache();
+  BytecodeAnalysisCache(const BytecodeAnalysisCache&) = delete;
+  BytecodeAnalysisCache& operator=(const BytecodeAnalysisCache&) = delete;
+
+  // Returns an analysis of {bytecode_array} that subsumes the requested one,
+  // computing it if there is none yet. {gc_epoch} is the number of full GCs so
+  // far, read while the calling thread can't be interrupted by a GC. The
+  // analysis stays alive as long as the returned pointer, even if the cache
+  // drops it.
+  std::shared_ptr<const BytecodeAnalysis> Get(
+      Handle<BytecodeArray> bytecode_array, BytecodeOffset osr_bailout_id,
+      bool analyze_liveness, int gc_epoch);
+
+  size_t size_for_testing();
+
+ private:
+  struct Entry;
+
+  // Bounds the memory held by analyses of functions that are never optimized
+  // again.
+  static constexpr size_t kMaxEntries = 128;
+
+  AccountingAllocator* const allocator_;
+  base::Mutex mutex_;
+  int gc_epoch_ = 0;
+  std::unordered_map<Address, std::shared_ptr<Entry>> entries_;
+};
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
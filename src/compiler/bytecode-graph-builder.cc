@@ -459,7 +459,7 @@ class BytecodeGraphBuilder {
   const FrameStateFunctionInfo* const frame_state_function_info_;
   std::unique_ptr<SourcePositionTableIterator> source_position_iterator_;
   interpreter::BytecodeArrayIterator bytecode_iterator_;
-  BytecodeAnalysis const bytecode_analysis_;
+  BytecodeAnalysis const& bytecode_analysis_;
   Environment* environment_;
   BytecodePositionDecorator* decorator_;
   bool const osr_;
@@ -1068,9 +1068,9 @@ BytecodeGraphBuilder::BytecodeGraphBuilder(
       source_position_iterator_(std::make_unique<SourcePositionTableIterator>(
           bytecode_array().SourcePositionTable(broker))),
       bytecode_iterator_(bytecode_array().object()),
-      bytecode_analysis_(
-          bytecode_array().object(), local_zone, osr_offset,
-          flags & BytecodeGraphBuilderFlag::kAnalyzeEnvironmentLiveness),
+      bytecode_analysis_(broker->GetBytecodeAnalysis(
+          bytecode_array(), osr_offset,
+          flags & BytecodeGraphBuilderFlag::kAnalyzeEnvironmentLiveness)),
       environment_(nullptr),
       decorator_(nullptr),
       osr_(!osr_offset.IsNone()),
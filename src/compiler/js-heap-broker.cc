@@ -9,6 +9,7 @@
 #endif
 
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/bytecode-analysis.h"
 #include "src/compiler/js-heap-broker-inl.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
@@ -49,7 +50,9 @@ JSHeapBroker::JSHeapBroker(Isolate* isolate, Zone* broker_zone,
       tracing_enabled_(tracing_enabled),
       code_kind_(code_kind),
       feedback_(zone()),
-      property_access_infos_(zone()) {
+      property_access_infos_(zone()),
+      bytecode_analyses_(zone()),
+      other_bytecode_analyses_(zone()) {
   TRACE(this, "Constructing heap broker");
 }
 
@@ -900,6 +903,37 @@ PropertyAccessInfo JSHeapBroker::GetPropertyAccessInfo(MapRef map, NameRef name,
   return access_info;
 }
 
+BytecodeAnalysis const& JSHeapBroker::GetBytecodeAnalysis(
+    BytecodeArrayRef bytecode_array, BytecodeOffset osr_offset,
+    bool analyze_liveness) {
+  auto it = bytecode_analyses_.find(bytecode_array.data());
+  // An OSR analysis can be reused when asked for the non-OSR one (e.g. when
+  // inlining the OSR'd function into itself).
+  if (it != bytecode_analyses_.end() &&
+      it->second->Subsumes(osr_offset, analyze_liveness)) {
+    return *it->second;
+  }
+
+  // Ask the isolate's cache, which holds the analyses done by other
+  // compilations of the same bytecode, e.g. by Maglev before tiering up to
+  // Turbofan. The bytecode array can't be moved by a GC meanwhile, as the
+  // compiling thread is not parked.
+  TRACE(this, "Getting BytecodeAnalysis for " << bytecode_array);
+  std::shared_ptr<const BytecodeAnalysis> analysis =
+      isolate()->bytecode_analysis_cache()->Get(
+          bytecode_array.object(), osr_offset, analyze_liveness,
+          isolate()->heap()->ms_count());
+  const BytecodeAnalysis& result = *analysis;
+  if (it == bytecode_analyses_.end()) {
+    bytecode_analyses_.insert({bytecode_array.data(), std::move(analysis)});
+  } else {
+    // Don't bother caching other combinations, they are rare. They are kept
+    // alive until the end of the compilation nonetheless.
+    other_bytecode_analyses_.push_back(std::move(analysis));
+  }
+  return result;
+}
+
 BinaryOperationFeedback const& ProcessedFeedback::AsBinaryOperation() const {
   CHECK_EQ(kBinaryOperation, kind());
   return *static_cast<BinaryOperationFeedback const*>(this);
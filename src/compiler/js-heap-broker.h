@@ -5,6 +5,8 @@
 #ifndef V8_COMPILER_JS_HEAP_BROKER_H_
 #define V8_COMPILER_JS_HEAP_BROKER_H_
 
+#include <memory>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/macros.h"
 #include "src/base/optional.h"
@@ -40,6 +42,7 @@ class MaglevCompilationInfo;
 
 namespace compiler {
 
+class BytecodeAnalysis;
 class ObjectRef;
 
 std::ostream& operator<<(std::ostream& os, ObjectRef ref);
@@ -247,6 +250,14 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   PropertyAccessInfo GetPropertyAccessInfo(MapRef map, NameRef name,
                                            AccessMode access_mode);
 
+  // Returns the (cached) bytecode analysis for {bytecode_array}. The same
+  // function is often inlined at several call sites and compiled by several
+  // tiers, and the analysis only depends on the bytecode, so it is shared
+  // within and across compilations (see BytecodeAnalysisCache).
+  BytecodeAnalysis const& GetBytecodeAnalysis(BytecodeArrayRef bytecode_array,
+                                              BytecodeOffset osr_offset,
+                                              bool analyze_liveness);
+
   StringRef GetTypedArrayStringTag(ElementsKind kind);
 
   bool IsMainThread() const {
@@ -477,6 +488,9 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   ZoneUnorderedMap<PropertyAccessTarget, PropertyAccessInfo,
                    PropertyAccessTarget::Hash, PropertyAccessTarget::Equal>
       property_access_infos_;
+  ZoneUnorderedMap<ObjectData*, std::shared_ptr<const BytecodeAnalysis>>
+      bytecode_analyses_;
+  ZoneVector<std::shared_ptr<const BytecodeAnalysis>> other_bytecode_analyses_;
 
   // Cache read only roots to avoid needing to look them up via the map.
 #define V(Type, name, Name) \
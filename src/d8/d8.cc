@@ -37,6 +37,7 @@
 #include "src/base/logging.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
 #include "src/base/sanitizer/msan.h"
@@ -539,6 +540,7 @@ std::map<v8::Isolate*, int> Shell::isolate_running_streaming_tasks_;
 base::LazyMutex Shell::cached_code_mutex_;
 std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
     Shell::cached_code_map_;
+std::unique_ptr<platform::CodeCacheStore> Shell::code_cache_store_;
 std::atomic<int> Shell::unhandled_promise_rejections_{0};
 
 Global<Context> Shell::evaluation_context_;
@@ -584,6 +586,81 @@ void Shell::StoreInCodeCache(Isolate* isolate, Local<Value> source,
                                      ScriptCompiler::CachedData::BufferOwned));
 }
 
+namespace {
+
+// Deserializes a code cache on a worker thread.
+class ConsumeCodeCacheTaskRunner final : public v8::Task {
+ public:
+  ConsumeCodeCacheTaskRunner(ScriptCompiler::ConsumeCodeCacheTask* task,
+                             base::Semaphore* done)
+      : task_(task), done_(done) {}
+
+  void Run() override {
+    task_->Run();
+    done_->Signal();
+  }
+
+ private:
+  ScriptCompiler::ConsumeCodeCacheTask* task_;
+  base::Semaphore* done_;
+};
+
+}  // namespace
+
+MaybeLocal<Script> Shell::CompileWithCodeCacheStore(
+    Isolate* isolate, Local<Context> context, Local<String> source,
+    const ScriptOrigin& origin) {
+  String::Value chars(isolate, source);
+  platform::CodeCacheStore::Key key{
+      platform::CodeCacheStore::HashSource(*chars,
+                                           chars.length() * sizeof(uint16_t)),
+      static_cast<uint32_t>(chars.length()),
+      ScriptCompiler::CachedDataVersionTag()};
+  std::unique_ptr<platform::CodeCacheStore::Entry> entry =
+      code_cache_store_->Lookup(key);
+  MaybeLocal<Script> result;
+  bool produce_cache = true;
+  if (entry) {
+    int length = static_cast<int>(entry->length());
+    std::unique_ptr<ScriptCompiler::ConsumeCodeCacheTask> consume_task(
+        ScriptCompiler::StartConsumingCodeCache(
+            isolate, std::make_unique<ScriptCompiler::CachedData>(
+                         entry->data(), length,
+                         ScriptCompiler::CachedData::BufferNotOwned)));
+    // Deserialize in the background, while this thread looks for an existing
+    // script to merge the result into.
+    base::Semaphore done(0);
+    PostBlockingBackgroundTask(std::make_unique<ConsumeCodeCacheTaskRunner>(
+        consume_task.get(), &done));
+    consume_task->SourceTextAvailable(isolate, source, origin);
+    done.Wait();
+    if (consume_task->ShouldMergeWithExistingScript()) {
+      consume_task->MergeWithExistingScript();
+    }
+    ScriptCompiler::Source script_source(
+        source, origin,
+        new ScriptCompiler::CachedData(
+            entry->data(), length, ScriptCompiler::CachedData::BufferNotOwned),
+        consume_task.release());
+    result = ScriptCompiler::Compile(context, &script_source,
+                                     ScriptCompiler::kConsumeCodeCache);
+    // Replace entries that V8 rejected, e.g. because they were corrupted.
+    produce_cache = script_source.GetCachedData()->rejected;
+  } else {
+    ScriptCompiler::Source script_source(source, origin);
+    result = ScriptCompiler::Compile(context, &script_source);
+  }
+  Local<Script> script;
+  if (produce_cache && result.ToLocal(&script)) {
+    std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (cached_data) {
+      code_cache_store_->Store(key, cached_data->data, cached_data->length);
+    }
+  }
+  return result;
+}
+
 // Dummy external source stream which returns the whole source in one go.
 // TODO(leszeks): Also test chunking the data.
 class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
@@ -701,6 +778,12 @@ MaybeLocal<T> Shell::CompileString(Isolate* isolate, Local<Context> context,
     return CompileStreamed<T>(context, &streamed_source, source, origin);
   }
 
+  if constexpr (std::is_same<T, Script>::value) {
+    if (code_cache_store_) {
+      return CompileWithCodeCacheStore(isolate, context, source, origin);
+    }
+  }
+
   ScriptCompiler::CachedData* cached_code = nullptr;
   if (options.compile_options == ScriptCompiler::kConsumeCodeCache) {
     cached_code = LookupCodeCache(isolate, source);
@@ -4997,6 +5080,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.snapshot_blob = argv[i] + 16;
       argv[i] = nullptr;
 #endif  // V8_USE_EXTERNAL_STARTUP_DATA
+    } else if (strncmp(argv[i], "--code-cache-dir=", 17) == 0) {
+      options.code_cache_dir = argv[i] + 17;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--cache") == 0 ||
                strncmp(argv[i], "--cache=", 8) == 0) {
       const char* value = argv[i] + 7;
@@ -5865,6 +5951,11 @@ int Shell::Main(int argc, char* argv[]) {
     g_platform = MakeDelayedTasksPlatform(std::move(g_platform), random_seed);
   }
 
+  if (options.code_cache_dir) {
+    code_cache_store_ = v8::platform::NewCodeCacheStore(
+        g_default_platform, options.code_cache_dir);
+  }
+
   if (i::v8_flags.trace_turbo_cfg_file == nullptr) {
     V8::SetFlagsFromString("--trace-turbo-cfg-file=turbo.cfg");
   }
@@ -6135,6 +6226,7 @@ int Shell::Main(int argc, char* argv[]) {
 
     // Shut down contexts and collect garbage.
     cached_code_map_.clear();
+    code_cache_store_.reset();
     evaluation_context_.Reset();
     stringify_function_.Reset();
     ResetOnProfileEndListener(isolate);
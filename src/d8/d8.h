@@ -14,6 +14,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "include/libplatform/code-cache-store.h"
 #include "include/v8-array-buffer.h"
 #include "include/v8-isolate.h"
 #include "include/v8-script.h"
@@ -449,6 +450,8 @@ class ShellOptions {
   DisallowReassignment<const char*> icu_data_file = {"icu-data-file", nullptr};
   DisallowReassignment<const char*> icu_locale = {"icu-locale", nullptr};
   DisallowReassignment<const char*> snapshot_blob = {"snapshot_blob", nullptr};
+  DisallowReassignment<const char*> code_cache_dir = {"code-cache-dir",
+                                                     nullptr};
   DisallowReassignment<bool> trace_enabled = {"trace-enabled", false};
   DisallowReassignment<const char*> trace_path = {"trace-path", nullptr};
   DisallowReassignment<const char*> trace_config = {"trace-config", nullptr};
@@ -807,6 +810,11 @@ class Shell : public i::AllStatic {
                                                      Local<Value> name);
   static void StoreInCodeCache(Isolate* isolate, Local<Value> name,
                                const ScriptCompiler::CachedData* data);
+  // Compiles a script, using and filling the on-disk code cache in
+  // --code-cache-dir.
+  static MaybeLocal<Script> CompileWithCodeCacheStore(
+      Isolate* isolate, Local<Context> context, Local<String> source,
+      const ScriptOrigin& origin);
   // We may have multiple isolates running concurrently, so the access to
   // the isolate_status_ needs to be concurrency-safe.
   static base::LazyMutex isolate_status_lock_;
@@ -816,6 +824,7 @@ class Shell : public i::AllStatic {
   static base::LazyMutex cached_code_mutex_;
   static std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
       cached_code_map_;
+  static std::unique_ptr<platform::CodeCacheStore> code_cache_store_;
   static std::atomic<int> unhandled_promise_rejections_;
 };
 
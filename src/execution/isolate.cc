@@ -39,6 +39,7 @@
 #include "src/common/ptr-compr-inl.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/compiler/bytecode-analysis.h"
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
@@ -3779,6 +3780,9 @@ void Isolate::Deinit() {
 
   FutexEmulation::IsolateDeinit(this);
 
+  // No more contexts can be created from the snapshot.
+  SharedSnapshotData::Get()->Release(this);
+
   debug()->Unload();
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -3909,6 +3913,7 @@ void Isolate::Deinit() {
   delete compiler_zone_;
   compiler_zone_ = nullptr;
   compiler_cache_ = nullptr;
+  bytecode_analysis_cache_.reset();
 
   SetCodePages(nullptr);
 
@@ -4381,6 +4386,33 @@ using MapOfLoadsAndStoresPerFunction =
              std::pair<uint64_t /* loads */, uint64_t /* stores */>>;
 MapOfLoadsAndStoresPerFunction* stack_access_count_map = nullptr;
 
+// Processes the items of a bigint::Platform::ParallelWork on the calling
+// thread, which joins the job, and on as many worker threads as are free.
+class BigIntParallelWorkJob final : public JobTask {
+ public:
+  BigIntParallelWorkJob(bigint::Platform::ParallelWork* work, int count)
+      : work_(work), count_(count), remaining_items_(count) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      int index = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count_) return;
+      work_->Run(index);
+      remaining_items_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return remaining_items_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  bigint::Platform::ParallelWork* const work_;
+  const int count_;
+  std::atomic<int> next_item_{0};
+  std::atomic<size_t> remaining_items_;
+};
+
 class BigIntPlatform : public bigint::Platform {
  public:
   explicit BigIntPlatform(Isolate* isolate) : isolate_(isolate) {}
@@ -4392,6 +4424,18 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int NumberOfWorkerThreads() override {
+    if (!v8_flags.parallel_bigint) return 0;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  }
+
+  void RunInParallel(ParallelWork* work, int count) override {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BigIntParallelWorkJob>(work, count))
+        ->Join();
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -4560,6 +4604,8 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
   interpreter_ = new interpreter::Interpreter(this);
+  bytecode_analysis_cache_ =
+      std::make_unique<compiler::BytecodeAnalysisCache>(allocator());
   bigint_processor_ = bigint::Processor::New(new BigIntPlatform(this));
 
   if (is_shared_space_isolate_) {
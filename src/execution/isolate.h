@@ -165,6 +165,7 @@ class Interpreter;
 }  // namespace interpreter
 
 namespace compiler {
+class BytecodeAnalysisCache;
 class NodeObserver;
 class PerIsolateCompilerCache;
 }  // namespace compiler
@@ -1859,6 +1860,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     compiler_zone_ = zone;
   }
 
+  compiler::BytecodeAnalysisCache* bytecode_analysis_cache() const {
+    return bytecode_analysis_cache_.get();
+  }
+
   AccountingAllocator* allocator() { return allocator_; }
 
   LazyCompileDispatcher* lazy_compile_dispatcher() const {
@@ -2416,6 +2421,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // The following zone is for compiler-related objects that should live
   // through all compilations (and thus all JSHeapBroker instances).
   Zone* compiler_zone_ = nullptr;
+  std::unique_ptr<compiler::BytecodeAnalysisCache> bytecode_analysis_cache_;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
 #ifdef V8_ENABLE_SPARKPLUG
@@ -532,6 +532,12 @@ DEFINE_BOOL(maglev_inlining, true,
             "enable inlining in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_loop_peeling, false,
             "enable loop peeling in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_dead_allocation_elimination, false,
+            "remove inline allocations that are never read in the maglev "
+            "optimizing compiler")
+DEFINE_BOOL(maglev_pretenure_store_values, false,
+            "pretenure young inline allocations that are stored into old "
+            "inline allocations in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_deopt_data_on_background, true,
             "Generate deopt data on background thread")
 DEFINE_BOOL(maglev_build_code_on_background, true,
@@ -544,6 +550,8 @@ DEFINE_BOOL(maglev_inline_api_calls, false,
             "Inline CallApiCallback builtin into generated code")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inlining)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_loop_peeling)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_dead_allocation_elimination)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_pretenure_store_values)
 // This might be too big of a hammer but we must prohibit moving the C++
 // trampolines while we are executing a C++ code.
 DEFINE_NEG_IMPLICATION(maglev_inline_api_calls, compact_code_space_with_stack)
@@ -623,6 +631,8 @@ DEFINE_BOOL(print_maglev_deopt_verbose, false, "print verbose deopt info")
 DEFINE_BOOL(print_maglev_graph, false, "print the final maglev graph")
 DEFINE_BOOL(print_maglev_graphs, false, "print maglev graph across all phases")
 DEFINE_BOOL(trace_maglev_phi_untagging, false, "trace maglev phi untagging")
+DEFINE_BOOL(trace_maglev_dead_allocation_elimination, false,
+            "trace maglev dead allocation elimination")
 DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
 #else
 DEFINE_BOOL_READONLY(print_maglev_deopt_verbose, false,
@@ -632,6 +642,8 @@ DEFINE_BOOL_READONLY(print_maglev_graphs, false,
                      "print maglev graph across all phases")
 DEFINE_BOOL_READONLY(trace_maglev_phi_untagging, false,
                      "trace maglev phi untagging")
+DEFINE_BOOL_READONLY(trace_maglev_dead_allocation_elimination, false,
+                     "trace maglev dead allocation elimination")
 DEFINE_BOOL_READONLY(trace_maglev_regalloc, false,
                      "trace maglev register allocation")
 #endif  // V8_ENABLE_MAGLEV_GRAPH_PRINTER
@@ -733,6 +745,14 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_site_pretenuring_decay, false,
+            "periodically re-evaluate the pretenuring decisions of allocation "
+            "sites, also those that were decided not to be pretenured")
+DEFINE_INT(allocation_site_pretenuring_decay_interval, 4,
+           "number of full GCs after which tenured allocation sites are "
+           "re-evaluated, doubled each time a site is tenured again")
+DEFINE_NEG_NEG_IMPLICATION(allocation_site_pretenuring,
+                           allocation_site_pretenuring_decay)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -751,6 +771,16 @@ DEFINE_UINT(minor_ms_max_new_space_capacity_mb, 72,
 DEFINE_UINT(scavenger_max_new_space_capacity_mb, 8,
             "max new space capacity in MBs when using Scavenger. When pointer "
             "compression is disabled, twice the capacity is used.")
+DEFINE_BOOL(adaptive_young_generation, false,
+            "size new space from the observed allocation throughput, survival "
+            "ratio and young GC speed, up to a maximum that scales with the "
+            "physical memory of the host")
+DEFINE_INT(adaptive_young_generation_gc_interval_ms, 100,
+           "time of allocation that new space should absorb between young "
+           "GCs with --adaptive-young-generation")
+DEFINE_INT(adaptive_young_generation_max_pause_ms, 5,
+           "maximum young GC pause that --adaptive-young-generation sizes new "
+           "space for")
 DEFINE_BOOL(trace_page_promotions, false, "trace page promotion decisions")
 DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
@@ -1671,6 +1701,9 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(parallel_array_buffer_release, true,
+            "release the backing stores of dead array buffers in batches on "
+            "multiple threads")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
@@ -1686,6 +1719,9 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_FLOAT(finalization_registry_cleanup_task_budget_ms, 0,
+             "time budget in ms for calling the cleanup callbacks of a "
+             "FinalizationRegistry in one task, 0 for no limit")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1752,6 +1788,14 @@ DEFINE_INT(memory_reducer_gc_count, 3,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages, false,
+            "advise the OS to back the pointer compression cage, the code "
+            "range and regular heap pages with (transparent) huge pages, and "
+            "keep some pooled pages committed so that huge pages are not "
+            "split")
+DEFINE_SIZE_T(huge_pages_max_committed_pool_size_mb, 8,
+              "max size in MBs of freed pages that stay committed for reuse "
+              "with --huge-pages, unless the heap reduces its memory usage")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1759,6 +1803,11 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_INT(evacuation_pause_budget_ms, 0,
+           "Bound the time spent on evacuating old generation pages in the "
+           "atomic pause of latency-critical full GCs, based on the measured "
+           "compaction speed. Candidates over the budget are left for later "
+           "GCs. 0 means unbounded.")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -1844,6 +1893,9 @@ DEFINE_BOOL(cppheap_concurrent_marking, false,
 DEFINE_NEG_NEG_IMPLICATION(cppheap_incremental_marking,
                            cppheap_concurrent_marking)
 DEFINE_WEAK_IMPLICATION(concurrent_marking, cppheap_concurrent_marking)
+DEFINE_BOOL(cppheap_lazy_sweeping, false,
+            "only sweep CppHeap pages and run their finalizers on allocation "
+            "and in idle time")
 
 DEFINE_BOOL(memory_balancer, false,
             "use membalancer, "
@@ -1854,6 +1906,16 @@ DEFINE_FLOAT(memory_balancer_c_value, 3e-10,
              "The smaller the more memory it uses.")
 DEFINE_NEG_IMPLICATION(memory_balancer, memory_reducer)
 DEFINE_BOOL(trace_memory_balancer, false, "print memory balancer behavior.")
+DEFINE_BOOL(gc_pause_target, false,
+            "budget the main thread's GC work so that the mutator gets at "
+            "least --gc-mutator-utilization of every window")
+DEFINE_IMPLICATION(gc_pause_target, memory_balancer)
+DEFINE_FLOAT(gc_mutator_utilization, 0.9,
+             "share of every window that pause-target mode leaves to the "
+             "mutator")
+DEFINE_INT(gc_mutator_utilization_window_ms, 100,
+           "length of the window over which pause-target mode measures "
+           "mutator utilization")
 
 // assembler-ia32.cc / assembler-arm.cc / assembler-arm64.cc / assembler-x64.cc
 #ifdef V8_ENABLE_DEBUG_CODE
@@ -2108,6 +2170,9 @@ DEFINE_INT(heap_snapshot_string_limit, 1024,
 DEFINE_BOOL(heap_profiler_show_hidden_objects, false,
             "use 'native' rather than 'hidden' node type in snapshot")
 DEFINE_BOOL(profile_heap_snapshot, false, "dump time spent on heap snapshot")
+DEFINE_BOOL(heap_snapshot_parallel_serialization, false,
+            "format the nodes and edges of heap snapshots on worker threads "
+            "while serializing them; generating snapshots is not affected")
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
 DEFINE_BOOL(heap_snapshot_verify, false,
             "verify that heap snapshot matches marking visitor behavior")
@@ -2281,6 +2346,20 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_STRING(snapshot_compression_codec, "lz4",
+              "Codec for compressing snapshots: lz4 (fast decompression) or "
+              "zlib (smaller snapshots). (mksnapshot only)")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "Decompress the chunks of large snapshots on background threads.")
+DEFINE_BOOL(share_snapshot_data, false,
+            "Decompress and verify the default snapshot only once and share "
+            "the result between the isolates that are alive at the same time. "
+            "Useful for embedders creating many isolates, but keeps the "
+            "decompressed snapshot in memory for the lifetime of each isolate.")
+
+// startup-data-util.cc
+DEFINE_BOOL(mmap_snapshot_blob, true,
+            "Map the external snapshot blob into memory instead of reading it.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
@@ -2773,8 +2852,12 @@ DEFINE_NEG_IMPLICATION(predictable_gc_schedule, memory_reducer)
 // Threading related flags.
 //
 
+DEFINE_BOOL(parallel_bigint, true,
+            "use background threads for operations on very large BigInts")
 DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
@@ -2798,6 +2881,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_array_buffer_release)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
 
@@ -4,8 +4,10 @@
 
 #include "src/heap/array-buffer-sweeper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/heap/gc-tracer-inl.h"
@@ -13,6 +15,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/remembered-set.h"
+#include "src/init/v8.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tasks/task-utils.h"
@@ -77,14 +80,58 @@ bool ArrayBufferList::IsEmpty() const {
   return head_ == nullptr;
 }
 
+namespace {
+
+// Deletes dead ArrayBufferExtensions in batches on multiple threads. Deleting
+// an extension releases its backing store, which is often the most expensive
+// part of sweeping when there are many array buffers.
+class ReleaseExtensionsJob final : public JobTask {
+ public:
+  static constexpr size_t kBatchSize = 256;
+  // Backing stores are released through the embedder's ArrayBuffer::Allocator,
+  // which usually takes a lock. More threads would mostly contend on it.
+  static constexpr size_t kMaxTasks = 4;
+
+  explicit ReleaseExtensionsJob(
+      const std::vector<ArrayBufferExtension*>& extensions)
+      : extensions_(extensions) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t start = next_.fetch_add(kBatchSize, std::memory_order_relaxed);
+      if (start >= extensions_.size()) return;
+      size_t end = std::min(start + kBatchSize, extensions_.size());
+      for (size_t i = start; i < end; i++) {
+        delete extensions_[i];
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = std::min(next_.load(std::memory_order_relaxed),
+                           extensions_.size());
+    size_t remaining_batches =
+        (extensions_.size() - next + kBatchSize - 1) / kBatchSize;
+    return std::min(kMaxTasks, worker_count + remaining_batches);
+  }
+
+ private:
+  const std::vector<ArrayBufferExtension*>& extensions_;
+  std::atomic<size_t> next_{0};
+};
+
+}  // namespace
+
 struct ArrayBufferSweeper::SweepingJob final {
   SweepingJob(ArrayBufferList young, ArrayBufferList old, SweepingType type,
-              TreatAllYoungAsPromoted treat_all_young_as_promoted)
+              TreatAllYoungAsPromoted treat_all_young_as_promoted,
+              bool release_in_parallel)
       : state_(SweepingState::kInProgress),
         young_(std::move(young)),
         old_(std::move(old)),
         type_(type),
-        treat_all_young_as_promoted_(treat_all_young_as_promoted) {}
+        treat_all_young_as_promoted_(treat_all_young_as_promoted),
+        release_in_parallel_(release_in_parallel) {}
 
   void Sweep();
   void SweepYoung();
@@ -92,6 +139,14 @@ struct ArrayBufferSweeper::SweepingJob final {
   ArrayBufferList SweepListFull(ArrayBufferList* list);
 
  private:
+  // Below this number of dead extensions, posting a job costs more than
+  // deleting them on the sweeping thread.
+  static constexpr size_t kMinExtensionsForParallelRelease =
+      4 * ReleaseExtensionsJob::kBatchSize;
+
+  void Release(ArrayBufferExtension* extension);
+  void ReleaseDeadExtensions();
+
   CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
   std::atomic<SweepingState> state_;
   ArrayBufferList young_;
@@ -99,6 +154,9 @@ struct ArrayBufferSweeper::SweepingJob final {
   const SweepingType type_;
   size_t freed_bytes_{0};
   TreatAllYoungAsPromoted treat_all_young_as_promoted_;
+  const bool release_in_parallel_;
+  // Extensions found dead while sweeping, when they are released in parallel.
+  std::vector<ArrayBufferExtension*> dead_extensions_;
 
   friend class ArrayBufferSweeper;
 };
@@ -210,15 +268,20 @@ void ArrayBufferSweeper::Prepare(
   DCHECK(!sweeping_in_progress());
   DCHECK_IMPLIES(type == SweepingType::kFull,
                  treat_all_young_as_promoted == TreatAllYoungAsPromoted::kYes);
+  const bool release_in_parallel = v8_flags.parallel_array_buffer_release &&
+                                   !heap_->IsTearingDown() &&
+                                   heap_->ShouldUseBackgroundThreads();
   switch (type) {
     case SweepingType::kYoung: {
       job_ = std::make_unique<SweepingJob>(std::move(young_), ArrayBufferList(),
-                                           type, treat_all_young_as_promoted);
+                                           type, treat_all_young_as_promoted,
+                                           release_in_parallel);
       young_ = ArrayBufferList();
     } break;
     case SweepingType::kFull: {
       job_ = std::make_unique<SweepingJob>(std::move(young_), std::move(old_),
-                                           type, treat_all_young_as_promoted);
+                                           type, treat_all_young_as_promoted,
+                                           release_in_parallel);
       young_ = ArrayBufferList();
       old_ = ArrayBufferList();
     } break;
@@ -315,9 +378,36 @@ void ArrayBufferSweeper::SweepingJob::Sweep() {
       SweepFull();
       break;
   }
+  ReleaseDeadExtensions();
   state_ = SweepingState::kDone;
 }
 
+void ArrayBufferSweeper::SweepingJob::Release(
+    ArrayBufferExtension* extension) {
+  const size_t bytes = extension->accounting_length();
+  if (bytes) freed_bytes_ += bytes;
+  if (release_in_parallel_) {
+    dead_extensions_.push_back(extension);
+  } else {
+    delete extension;
+  }
+}
+
+void ArrayBufferSweeper::SweepingJob::ReleaseDeadExtensions() {
+  if (dead_extensions_.size() >= kMinExtensionsForParallelRelease) {
+    // The sweeping thread joins the job and releases batches as well.
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserVisible,
+                    std::make_unique<ReleaseExtensionsJob>(dead_extensions_))
+        ->Join();
+  } else {
+    for (ArrayBufferExtension* extension : dead_extensions_) {
+      delete extension;
+    }
+  }
+  std::vector<ArrayBufferExtension*>().swap(dead_extensions_);
+}
+
 void ArrayBufferSweeper::SweepingJob::SweepFull() {
   DCHECK_EQ(SweepingType::kFull, type_);
   ArrayBufferList promoted = SweepListFull(&young_);
@@ -336,9 +426,7 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_ += bytes;
+      Release(current);
     } else {
       current->Unmark();
       survivor_list.Append(current);
@@ -362,9 +450,7 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_ += bytes;
+      Release(current);
     } else if ((treat_all_young_as_promoted_ ==
                 TreatAllYoungAsPromoted::kYes) ||
                current->IsYoungPromoted()) {
@@ -935,7 +935,10 @@ void CppHeap::FinishMarkingAndStartSweeping() {
             ? cppgc::internal::SweepingConfig::FreeMemoryHandling::
                   kDiscardWherePossible
             : cppgc::internal::SweepingConfig::FreeMemoryHandling::
-                  kDoNotDiscard};
+                  kDoNotDiscard,
+        v8_flags.cppheap_lazy_sweeping
+            ? cppgc::internal::SweepingConfig::LazySweeping::kEnabled
+            : cppgc::internal::SweepingConfig::LazySweeping::kDisabled};
     DCHECK_IMPLIES(!isolate_,
                    SweepingType::kAtomic == sweeping_config.sweeping_type);
     sweeper().Start(sweeping_config);
@@ -4,12 +4,18 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
 #include <map>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "include/cppgc/macros.h"
+#include "include/cppgc/platform.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -35,6 +41,11 @@ static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 //
 // The MovableReferences object is created and maintained for the lifetime
 // of one heap compaction-enhanced GC.
+//
+// Pages may be compacted in parallel. Lookups then do not change the maps, and
+// the entry of an interior slot is only accessed under its lock, by the thread
+// relocating the object that contains the slot and by the thread relocating
+// the object the slot refers to.
 class MovableReferences final {
   using MovableReference = CompactionWorklists::MovableReference;
 
@@ -49,13 +60,26 @@ class MovableReferences final {
   void Relocate(Address from, Address to, size_t size_including_header);
 
   // Relocates interior slots in a backing store that is moved |from| -> |to|.
+  // |from| and |to| are the same for backing stores that stay in place.
   void RelocateInteriorReferences(Address from, Address to, size_t size);
 
+  bool HasInteriorReferences() const {
+    return !interior_movable_references_.empty();
+  }
+
   // Updates the collection of callbacks from the item pushed the worklist by
   // marking visitors.
   void UpdateCallbacks();
 
  private:
+  static constexpr size_t kInteriorSlotMutexCount = 64;
+
+  v8::base::Mutex& InteriorSlotMutex(MovableReference* slot) {
+    return interior_slot_mutexes_[(reinterpret_cast<uintptr_t>(slot) /
+                                   sizeof(MovableReference)) %
+                                  kInteriorSlotMutexCount];
+  }
+
   HeapBase& heap_;
 
   // Map from movable reference (value) to its slot. Upon moving an object its
@@ -68,14 +92,22 @@ class MovableReferences final {
   // Requires log(n) lookup to make the early bailout reasonably fast.
   //
   // - The initial value for a given key is nullptr.
-  // - Upon moving an object this value is adjusted accordingly.
+  // - When the object containing the slot is relocated first, the value is the
+  //   new location of the slot. Relocating the object the slot refers to then
+  //   updates the slot there.
+  // - When the object the slot refers to is relocated first, the value is its
+  //   new location. Relocating the object containing the slot then writes it
+  //   to the slot.
   std::map<MovableReference*, Address> interior_movable_references_;
+  std::array<v8::base::Mutex, kInteriorSlotMutexCount> interior_slot_mutexes_;
 
   const bool heap_has_move_listeners_;
 
 #if DEBUG
   // The following two collections are used to allow refer back from a slot to
-  // an already moved object.
+  // an already moved object. |moved_objects_| is updated during parallel
+  // compaction.
+  v8::base::Mutex moved_objects_mutex_;
   std::unordered_set<const void*> moved_objects_;
   std::unordered_map<MovableReference*, MovableReference>
       interior_slot_to_object_;
@@ -139,10 +171,6 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
 
 void MovableReferences::Relocate(Address from, Address to,
                                  size_t size_including_header) {
-#if DEBUG
-  moved_objects_.insert(from);
-#endif  // DEBUG
-
   if (V8_UNLIKELY(heap_has_move_listeners_)) {
     heap_.CallMoveListeners(from - sizeof(HeapObjectHeader),
                             to - sizeof(HeapObjectHeader),
@@ -160,6 +188,13 @@ void MovableReferences::Relocate(Address from, Address to,
     RelocateInteriorReferences(from, to, size);
   }
 
+#if DEBUG
+  {
+    v8::base::MutexGuard guard(&moved_objects_mutex_);
+    moved_objects_.insert(from);
+  }
+#endif  // DEBUG
+
   auto it = movable_references_.find(from);
   // This means that there is no corresponding slot for a live object.
   // This may happen because a mutator may change the slot to point to a
@@ -174,19 +209,22 @@ void MovableReferences::Relocate(Address from, Address to,
   MovableReference* slot = it->second;
   auto interior_it = interior_movable_references_.find(slot);
   if (interior_it != interior_movable_references_.end()) {
+    v8::base::MutexGuard guard(&InteriorSlotMutex(slot));
     MovableReference* slot_location =
         reinterpret_cast<MovableReference*>(interior_it->second);
     if (!slot_location) {
+      // The slot is updated when the object containing it is relocated.
       interior_it->second = to;
 #if DEBUG
       // Check that the containing object has not been moved yet.
       auto reverse_it = interior_slot_to_object_.find(slot);
       DCHECK_NE(interior_slot_to_object_.end(), reverse_it);
+      v8::base::MutexGuard moved_objects_guard(&moved_objects_mutex_);
       DCHECK_EQ(moved_objects_.end(), moved_objects_.find(reverse_it->second));
 #endif  // DEBUG
-    } else {
-      slot = slot_location;
+      return;
     }
+    slot = slot_location;
   }
 
   // Compaction is atomic so slot should not be updated during compaction.
@@ -206,10 +244,11 @@ void MovableReferences::RelocateInteriorReferences(Address from, Address to,
 
   size_t offset = reinterpret_cast<Address>(interior_it->first) - from;
   while (offset < size) {
+    Address reference = to + offset;
+    v8::base::MutexGuard guard(&InteriorSlotMutex(interior_it->first));
     if (!interior_it->second) {
       // Update the interior reference value, so that when the object the slot
       // is pointing to is moved, it can re-use this value.
-      Address reference = to + offset;
       interior_it->second = reference;
 
       // If the |slot|'s content is pointing into the region [from, from +
@@ -220,6 +259,10 @@ void MovableReferences::RelocateInteriorReferences(Address from, Address to,
       if (reference_contents > from && reference_contents < (from + size)) {
         reference_contents = reference_contents - from + to;
       }
+    } else {
+      // The object the slot is pointing to was moved already, possibly while
+      // this object was being copied.
+      *reinterpret_cast<Address*>(reference) = interior_it->second;
     }
 
     interior_it++;
@@ -228,13 +271,45 @@ void MovableReferences::RelocateInteriorReferences(Address from, Address to,
   }
 }
 
+// Returns pages that are no longer needed after compaction to the backend.
+void DestroyPages(const std::vector<NormalPage*>& pages) {
+  for (NormalPage* page : pages) {
+    NormalPage::Destroy(page, FreeMemoryHandling::kDiscardWherePossible);
+  }
+}
+
+// The pages of a space after compacting some of them. They are handed back to
+// the space on the mutator thread, as spaces are not thread-safe.
+struct CompactedPages final {
+  // Pages that objects were compacted into.
+  std::vector<NormalPage*> used_pages;
+  // The unused remainders of |used_pages|.
+  std::vector<FreeList::Block> free_blocks;
+  // Pages that are no longer needed.
+  std::vector<NormalPage*> unused_pages;
+};
+
+void ReturnCompactedPages(NormalPageSpace* space,
+                          const CompactedPages& compacted_pages) {
+  for (NormalPage* page : compacted_pages.used_pages) {
+    space->AddPage(page);
+  }
+  for (const FreeList::Block& block : compacted_pages.free_blocks) {
+    space->free_list().Add(block);
+  }
+  DestroyPages(compacted_pages.unused_pages);
+}
+
 class CompactionState final {
   CPPGC_STACK_ALLOCATED();
   using Pages = std::vector<NormalPage*>;
 
  public:
-  CompactionState(NormalPageSpace* space, MovableReferences& movable_references)
-      : space_(space), movable_references_(movable_references) {}
+  CompactionState(NormalPageSpace* space, MovableReferences& movable_references,
+                  CompactedPages& compacted_pages)
+      : space_(space),
+        movable_references_(movable_references),
+        compacted_pages_(compacted_pages) {}
 
   void AddPage(NormalPage* page) {
     DCHECK_EQ(space_, &page->space());
@@ -253,7 +328,7 @@ class CompactionState final {
     if (compact_frontier + size > current_page_->PayloadEnd()) {
       // Can't fit on current page. Add remaining onto the freelist and advance
       // to next available page.
-      ReturnCurrentPageToSpace();
+      FinishCurrentPage();
 
       current_page_ = available_pages_.back();
       available_pages_.pop_back();
@@ -269,25 +344,31 @@ class CompactionState final {
       movable_references_.Relocate(header + sizeof(HeapObjectHeader),
                                    compact_frontier + sizeof(HeapObjectHeader),
                                    size);
+    } else if (movable_references_.HasInteriorReferences()) {
+      // Interior slots of objects that stay in place may still need to be
+      // updated for objects they refer to that were moved already.
+      movable_references_.RelocateInteriorReferences(
+          header + sizeof(HeapObjectHeader), header + sizeof(HeapObjectHeader),
+          size - sizeof(HeapObjectHeader));
     }
     current_page_->object_start_bitmap().SetBit(compact_frontier);
     used_bytes_in_current_page_ += size;
     DCHECK_LE(used_bytes_in_current_page_, current_page_->PayloadSize());
   }
 
-  void FinishCompactingSpace() {
+  void FinishCompacting() {
     // If the current page hasn't been allocated into, add it to the available
     // list, for subsequent release below.
     if (used_bytes_in_current_page_ == 0) {
       available_pages_.push_back(current_page_);
     } else {
-      ReturnCurrentPageToSpace();
+      FinishCurrentPage();
     }
 
-    // Return remaining available pages back to the backend.
+    // Pages that are no longer needed must be destroyed on the mutator thread.
     for (NormalPage* page : available_pages_) {
       SetMemoryInaccessible(page->PayloadStart(), page->PayloadSize());
-      NormalPage::Destroy(page, FreeMemoryHandling::kDiscardWherePossible);
+      compacted_pages_.unused_pages.push_back(page);
     }
   }
 
@@ -306,9 +387,9 @@ class CompactionState final {
   }
 
  private:
-  void ReturnCurrentPageToSpace() {
+  void FinishCurrentPage() {
     DCHECK_EQ(space_, &current_page_->space());
-    space_->AddPage(current_page_);
+    compacted_pages_.used_pages.push_back(current_page_);
     if (used_bytes_in_current_page_ != current_page_->PayloadSize()) {
       // Put the remainder of the page onto the free list.
       size_t freed_size =
@@ -316,13 +397,14 @@ class CompactionState final {
       Address payload = current_page_->PayloadStart();
       Address free_start = payload + used_bytes_in_current_page_;
       SetMemoryInaccessible(free_start, freed_size);
-      space_->free_list().Add({free_start, freed_size});
+      compacted_pages_.free_blocks.push_back({free_start, freed_size});
       current_page_->object_start_bitmap().SetBit(free_start);
     }
   }
 
   NormalPageSpace* space_;
   MovableReferences& movable_references_;
+  CompactedPages& compacted_pages_;
   // Page into which compacted object will be written to.
   NormalPage* current_page_ = nullptr;
   // Offset into |current_page_| to the next free address.
@@ -337,8 +419,15 @@ enum class StickyBits : uint8_t {
   kEnabled,
 };
 
+// Finalizers must run on the mutator thread. Pages that are compacted on
+// other threads have their dead objects finalized up front.
+enum class Finalization : uint8_t {
+  kInline,
+  kDone,
+};
+
 void CompactPage(NormalPage* page, CompactionState& compaction_state,
-                 StickyBits sticky_bits) {
+                 StickyBits sticky_bits, Finalization finalization) {
   compaction_state.AddPage(page);
 
   page->object_start_bitmap().Clear();
@@ -359,10 +448,10 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
     }
 
     if (!header->IsMarked()) {
-      // Compaction is currently launched only from AtomicPhaseEpilogue, so it's
-      // guaranteed to be on the mutator thread - no need to postpone
-      // finalization.
-      header->Finalize();
+      // Compaction is currently launched only from AtomicPhaseEpilogue. With
+      // inline finalization it's guaranteed to be on the mutator thread - no
+      // need to postpone finalization.
+      if (finalization == Finalization::kInline) header->Finalize();
 
       // As compaction is under way, leave the freed memory accessible
       // while compacting the rest of the page. We just zap the payload
@@ -392,24 +481,68 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
   compaction_state.FinishCompactingPage(page);
 }
 
-void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
-                  StickyBits sticky_bits) {
-  using Pages = NormalPageSpace::Pages;
-
+void PoisonUnmarkedObjects(NormalPageSpace* space) {
 #ifdef V8_USE_ADDRESS_SANITIZER
   UnmarkedObjectsPoisoner().Traverse(*space);
 #endif  // V8_USE_ADDRESS_SANITIZER
+}
+
+void FinalizeUnmarkedObjects(const std::vector<NormalPage*>& pages) {
+  for (NormalPage* page : pages) {
+    for (Address header_address = page->PayloadStart();
+         header_address < page->PayloadEnd();) {
+      HeapObjectHeader* header =
+          reinterpret_cast<HeapObjectHeader*>(header_address);
+      header_address += header->AllocatedSize();
+      if (header->IsFree() || header->IsMarked()) continue;
+      header->Finalize();
+    }
+  }
+}
 
-  DCHECK(space->is_compactable());
+// A run of consecutive pages of a compactable space, which is compacted into
+// itself. Distinct chunks can be compacted in parallel.
+struct CompactionChunk final {
+  NormalPageSpace* space;
+  std::vector<NormalPage*> pages;
+  CompactedPages compacted_pages;
+};
 
-  space->free_list().Clear();
+// The number of pages per chunk when compacting in parallel. Each chunk ends
+// with a partially used page, whose remainder goes to the free list.
+constexpr size_t kPagesPerParallelCompactionChunk = 16;
+
+// Takes the pages of |spaces| and splits them into chunks of at most
+// |pages_per_chunk| pages.
+std::vector<CompactionChunk> TakePagesForCompaction(
+    const std::vector<NormalPageSpace*>& spaces, size_t pages_per_chunk) {
+  std::vector<CompactionChunk> chunks;
+  for (NormalPageSpace* space : spaces) {
+    DCHECK(space->is_compactable());
+    PoisonUnmarkedObjects(space);
+    space->free_list().Clear();
+    NormalPageSpace::Pages pages = space->RemoveAllPages();
+    for (size_t i = 0; i < pages.size(); ++i) {
+      if (i % pages_per_chunk == 0) {
+        chunks.push_back({space, {}, {}});
+        chunks.back().pages.reserve(
+            std::min(pages_per_chunk, pages.size() - i));
+      }
+      // Large objects do not belong to this arena.
+      chunks.back().pages.push_back(NormalPage::From(pages[i]));
+    }
+  }
+  return chunks;
+}
 
+void CompactChunk(CompactionChunk& chunk, MovableReferences& movable_references,
+                  StickyBits sticky_bits, Finalization finalization) {
   // Compaction generally follows Jonker's algorithm for fast garbage
   // compaction. Compaction is performed in-place, sliding objects down over
   // unused holes for a smaller heap page footprint and improved locality. A
   // "compaction pointer" is consequently kept, pointing to the next available
   // address to move objects down to. It will belong to one of the already
-  // compacted pages for this space, but as compaction proceeds, it will not
+  // compacted pages for this chunk, but as compaction proceeds, it will not
   // belong to the same page as the one being currently compacted.
   //
   // The compaction pointer is represented by the
@@ -427,21 +560,78 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // as needed, and once finished, the chained, available pages can be
   // released back to the OS.
   //
+  // Objects never leave their chunk, so distinct chunks don't write to the
+  // same pages.
+  //
   // To ease the passing of the compaction state when iterating over an
   // arena's pages, package it up into a |CompactionState|.
+  CompactionState compaction_state(chunk.space, movable_references,
+                                   chunk.compacted_pages);
+  for (NormalPage* page : chunk.pages) {
+    CompactPage(page, compaction_state, sticky_bits, finalization);
+  }
+  compaction_state.FinishCompacting();
+  // Sweeping will verify object start bitmap of compacted space.
+}
 
-  Pages pages = space->RemoveAllPages();
-  if (pages.empty()) return;
+// Compacts chunks on worker threads, and on the mutator thread once it joins.
+// The mutator thread finalizes the dead objects of the chunks in order before,
+// and workers pick up the chunks that are finalized already meanwhile.
+class CompactionJobTask final : public cppgc::JobTask {
+ public:
+  CompactionJobTask(HeapBase& heap, std::vector<CompactionChunk>& chunks,
+                    MovableReferences& movable_references,
+                    StickyBits sticky_bits)
+      : heap_(heap),
+        chunks_(chunks),
+        movable_references_(movable_references),
+        sticky_bits_(sticky_bits) {}
+
+  // Called on the mutator thread once the next chunk is finalized.
+  void NotifyChunkFinalized() {
+    DCHECK_LT(finalized_chunks_.load(std::memory_order_relaxed),
+              chunks_.size());
+    finalized_chunks_.fetch_add(1, std::memory_order_release);
+  }
 
-  CompactionState compaction_state(space, movable_references);
-  for (BasePage* page : pages) {
-    // Large objects do not belong to this arena.
-    CompactPage(NormalPage::From(page), compaction_state, sticky_bits);
+  void Run(JobDelegate* delegate) override {
+    if (delegate->IsJoiningThread()) {
+      // Time on the mutator thread is accounted for in the atomic pause.
+      CompactChunks(delegate);
+      return;
+    }
+    StatsCollector::EnabledConcurrentScope stats_scope(
+        heap_.stats_collector(), StatsCollector::kConcurrentCompact);
+    CompactChunks(delegate);
   }
 
-  compaction_state.FinishCompactingSpace();
-  // Sweeping will verify object start bitmap of compacted space.
-}
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t finalized_chunks =
+        finalized_chunks_.load(std::memory_order_relaxed);
+    const size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return finalized_chunks - std::min(finalized_chunks, next_chunk);
+  }
+
+ private:
+  void CompactChunks(JobDelegate* delegate) {
+    while (!delegate->ShouldYield()) {
+      size_t chunk = next_chunk_.load(std::memory_order_relaxed);
+      do {
+        if (chunk >= finalized_chunks_.load(std::memory_order_acquire)) return;
+      } while (!next_chunk_.compare_exchange_weak(chunk, chunk + 1,
+                                                  std::memory_order_relaxed));
+      CompactChunk(chunks_[chunk], movable_references_, sticky_bits_,
+                   Finalization::kDone);
+    }
+  }
+
+  HeapBase& heap_;
+  std::vector<CompactionChunk>& chunks_;
+  MovableReferences& movable_references_;
+  const StickyBits sticky_bits_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> finalized_chunks_{0};
+};
 
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
   return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
@@ -522,12 +712,47 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   }
   compaction_worklists_.reset();
 
-  const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
-
-  for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(
-        space, movable_references,
-        young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
+  const StickyBits sticky_bits = heap_.heap()->generational_gc_supported()
+                                     ? StickyBits::kEnabled
+                                     : StickyBits::kDisabled;
+
+  // Move listeners are embedder callbacks and are only invoked on the mutator
+  // thread.
+  const bool compact_in_parallel =
+      heap_.heap()->marking_support() ==
+          cppgc::Heap::MarkingType::kIncrementalAndConcurrent &&
+      !heap_.heap()->HasMoveListeners();
+  std::vector<CompactionChunk> chunks = TakePagesForCompaction(
+      compactable_spaces_, compact_in_parallel
+                               ? kPagesPerParallelCompactionChunk
+                               : std::numeric_limits<size_t>::max());
+
+  std::unique_ptr<cppgc::JobHandle> job_handle;
+  CompactionJobTask* job_ptr = nullptr;
+  if (compact_in_parallel && chunks.size() > 1) {
+    auto job = std::make_unique<CompactionJobTask>(
+        *heap_.heap(), chunks, movable_references, sticky_bits);
+    job_ptr = job.get();
+    job_handle = heap_.heap()->platform()->PostJob(
+        cppgc::TaskPriority::kUserBlocking, std::move(job));
+  }
+  if (job_handle) {
+    // Finalizers must run on the mutator thread, so finalize chunks one by one
+    // and hand them over to the workers.
+    for (CompactionChunk& chunk : chunks) {
+      FinalizeUnmarkedObjects(chunk.pages);
+      job_ptr->NotifyChunkFinalized();
+      job_handle->NotifyConcurrencyIncrease();
+    }
+    job_handle->Join();
+  } else {
+    for (CompactionChunk& chunk : chunks) {
+      CompactChunk(chunk, movable_references, sticky_bits,
+                   Finalization::kInline);
+    }
+  }
+  for (const CompactionChunk& chunk : chunks) {
+    ReturnCompactedPages(chunk.space, chunk.compacted_pages);
   }
 
   enable_for_next_gc_for_testing_ = false;
@@ -16,6 +16,11 @@ namespace cppgc {
 namespace internal {
 
 namespace {
+
+// Number of entries checked in the bucket that may only potentially fit an
+// allocation.
+constexpr size_t kMaxEntriesToScanInFinalBucket = 4;
+
 uint32_t BucketIndexForSize(uint32_t size) {
   return v8::base::bits::WhichPowerOfTwo(
       v8::base::bits::RoundDownToPowerOfTwo32(size));
@@ -142,10 +147,30 @@ FreeList::Block FreeList::Allocate(size_t allocation_size) {
     DCHECK(IsConsistent(index));
     Entry* entry = free_list_heads_[index];
     if (allocation_size > bucket_size) {
-      // Final bucket candidate; check initial entry if it is able
-      // to service this allocation. Do not perform a linear scan,
-      // as it is considered too costly.
-      if (!entry || entry->AllocatedSize() < allocation_size) break;
+      // Final bucket candidate; check the first few entries if they are able
+      // to service this allocation. With mixed object sizes, the head of the
+      // bucket is often just too small. Do not perform a full linear scan, as
+      // it is considered too costly.
+      Entry* previous = nullptr;
+      for (size_t i = 0; entry && i < kMaxEntriesToScanInFinalBucket; ++i) {
+        if (entry->AllocatedSize() >= allocation_size) {
+          if (!entry->Next()) {
+            DCHECK_EQ(entry, free_list_tails_[index]);
+            free_list_tails_[index] = previous;
+          }
+          if (previous) {
+            previous->SetNext(entry->Next());
+            entry->SetNext(nullptr);
+          } else {
+            entry->Unlink(&free_list_heads_[index]);
+          }
+          biggest_free_list_index_ = index;
+          return {entry, entry->AllocatedSize()};
+        }
+        previous = entry;
+        entry = entry->Next();
+      }
+      break;
     }
     if (entry) {
       if (!entry->Next()) {
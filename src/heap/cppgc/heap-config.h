@@ -43,11 +43,15 @@ struct SweepingConfig {
   using SweepingType = cppgc::Heap::SweepingType;
   enum class CompactableSpaceHandling { kSweep, kIgnore };
   using FreeMemoryHandling = cppgc::internal::FreeMemoryHandling;
+  // With lazy sweeping, the mutator thread only sweeps pages (and runs their
+  // finalizers) when allocation needs memory from them, or in idle time.
+  enum class LazySweeping : uint8_t { kDisabled, kEnabled };
 
   SweepingType sweeping_type = SweepingType::kIncrementalAndConcurrent;
   CompactableSpaceHandling compactable_space_handling =
       CompactableSpaceHandling::kSweep;
   FreeMemoryHandling free_memory_handling = FreeMemoryHandling::kDoNotDiscard;
+  LazySweeping lazy_sweeping = LazySweeping::kDisabled;
 };
 
 struct GCConfig {
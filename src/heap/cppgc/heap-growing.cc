@@ -45,11 +45,15 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+  size_t limit_for_minor_gc() const { return limit_for_minor_gc_; }
+
+  void EnableMinorGCs();
 
   void DisableForTesting();
 
  private:
   void ConfigureLimit(size_t allocated_object_size);
+  void ConfigureMinorGCLimit(size_t allocated_object_size);
 
   GarbageCollector* collector_;
   StatsCollector* stats_collector_;
@@ -58,6 +62,15 @@ class HeapGrowing::HeapGrowingImpl final
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
 
+  bool minor_gcs_enabled_ = false;
+  size_t young_generation_size_ = HeapGrowing::kMinYoungGenerationSize;
+  size_t limit_for_minor_gc_ = SIZE_MAX;  // See ConfigureMinorGCLimit().
+  // Allocated object size after the most recent GC, and as seen by the most
+  // recent allocation notification. Their difference is the size of the young
+  // generation.
+  size_t allocated_object_size_after_gc_ = 0;
+  size_t last_allocated_object_size_ = 0;
+
   SingleThreadedHandle gc_task_handle_;
 
   bool disabled_for_testing_ = false;
@@ -91,21 +104,71 @@ HeapGrowing::HeapGrowingImpl::~HeapGrowingImpl() {
 void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
   if (disabled_for_testing_) return;
   size_t allocated_object_size = stats_collector_->allocated_object_size();
+  last_allocated_object_size_ = allocated_object_size;
   if (allocated_object_size > limit_for_atomic_gc_) {
     collector_->CollectGarbage(
         {CollectionType::kMajor, StackState::kMayContainHeapPointers,
          GCConfig::MarkingType::kAtomic, sweeping_support_});
-  } else if (allocated_object_size > limit_for_incremental_gc_) {
-    if (marking_support_ == cppgc::Heap::MarkingType::kAtomic) return;
+  } else if (allocated_object_size > limit_for_incremental_gc_ &&
+             marking_support_ != cppgc::Heap::MarkingType::kAtomic) {
     collector_->StartIncrementalGarbageCollection(
         {CollectionType::kMajor, StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
+  } else if (allocated_object_size > limit_for_minor_gc_) {
+    // Minor GCs are always atomic.
+    collector_->CollectGarbage(
+        {CollectionType::kMinor, StackState::kMayContainHeapPointers,
+         GCConfig::MarkingType::kAtomic, GCConfig::SweepingType::kAtomic});
   }
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
-  ConfigureLimit(allocated_object_size);
+  if (stats_collector_->collection_type_of_current_cycle() ==
+      CollectionType::kMajor) {
+    ConfigureLimit(allocated_object_size);
+  }
+  ConfigureMinorGCLimit(allocated_object_size);
+}
+
+void HeapGrowing::HeapGrowingImpl::EnableMinorGCs() {
+  if (minor_gcs_enabled_) return;
+  minor_gcs_enabled_ = true;
+  allocated_object_size_after_gc_ = stats_collector_->allocated_object_size();
+  limit_for_minor_gc_ =
+      allocated_object_size_after_gc_ + young_generation_size_;
+}
+
+void HeapGrowing::HeapGrowingImpl::ConfigureMinorGCLimit(
+    size_t allocated_object_size) {
+  if (!minor_gcs_enabled_) return;
+  if (stats_collector_->collection_type_of_current_cycle() ==
+          CollectionType::kMinor &&
+      last_allocated_object_size_ > allocated_object_size_after_gc_) {
+    // Bytes of young objects that survived are accumulated in
+    // |allocated_object_size|.
+    const size_t young_bytes =
+        last_allocated_object_size_ - allocated_object_size_after_gc_;
+    const size_t surviving_bytes =
+        allocated_object_size > allocated_object_size_after_gc_
+            ? allocated_object_size - allocated_object_size_after_gc_
+            : 0;
+    const double survival_rate =
+        static_cast<double>(surviving_bytes) / young_bytes;
+    // Minor GCs are wasted work if most young objects survive them. Reduce
+    // their frequency in that case, and go back to frequent minor GCs once the
+    // young objects die young again.
+    if (survival_rate > HeapGrowing::kHighSurvivalRate) {
+      young_generation_size_ = std::min(young_generation_size_ * 2,
+                                        HeapGrowing::kMaxYoungGenerationSize);
+    } else if (survival_rate < HeapGrowing::kLowSurvivalRate) {
+      young_generation_size_ = std::max(young_generation_size_ / 2,
+                                        HeapGrowing::kMinYoungGenerationSize);
+    }
+  }
+  allocated_object_size_after_gc_ = allocated_object_size;
+  last_allocated_object_size_ = allocated_object_size;
+  limit_for_minor_gc_ = allocated_object_size + young_generation_size_;
 }
 
 void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
@@ -160,6 +223,11 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+size_t HeapGrowing::limit_for_minor_gc() const {
+  return impl_->limit_for_minor_gc();
+}
+
+void HeapGrowing::EnableMinorGCs() { impl_->EnableMinorGCs(); }
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
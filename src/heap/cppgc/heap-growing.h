@@ -24,6 +24,10 @@ class StatsCollector;
 //
 // Implements a fixed-ratio growing strategy with an initial heap size that the
 // GC can ignore to avoid excessive GCs for smaller heaps.
+//
+// With young generation enabled, minor GCs are triggered after allocating a
+// young generation budget that adapts to the survival rate of the previous
+// minor GC. The limits for major GCs are only updated by major GCs.
 class V8_EXPORT_PRIVATE HeapGrowing final {
  public:
   // Constant growing factor for growing the heap limit.
@@ -32,6 +36,14 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
   // before triggering GC again.
   static constexpr size_t kMinLimitIncrease =
       kPageSize * RawHeap::kNumberOfRegularSpaces;
+  // Bounds for the bytes allocated between minor GCs.
+  static constexpr size_t kMinYoungGenerationSize = 1 * kMB;
+  static constexpr size_t kMaxYoungGenerationSize = 16 * kMB;
+  // The young generation budget grows if more than this ratio of the young
+  // objects survived the previous minor GC, and shrinks if fewer than
+  // |kLowSurvivalRate| survived.
+  static constexpr double kHighSurvivalRate = 0.5;
+  static constexpr double kLowSurvivalRate = 0.1;
 
   HeapGrowing(GarbageCollector*, StatsCollector*,
               cppgc::Heap::ResourceConstraints, cppgc::Heap::MarkingType,
@@ -43,6 +55,12 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
 
   size_t limit_for_atomic_gc() const;
   size_t limit_for_incremental_gc() const;
+  // Returns SIZE_MAX if minor GCs are not scheduled.
+  size_t limit_for_minor_gc() const;
+
+  // Starts scheduling minor GCs. Must only be called once the heap supports
+  // generational GC.
+  void EnableMinorGCs();
 
   void DisableForTesting();
 
@@ -106,6 +106,12 @@ void Heap::CollectGarbage(GCConfig config) {
     return;
   }
 
+  // A major GC that is already running also collects the young generation.
+  if (config.collection_type == CollectionType::kMinor &&
+      (IsMarking() || !generational_gc_supported())) {
+    return;
+  }
+
   config_ = config;
 
   if (!IsMarking()) {
@@ -182,6 +188,7 @@ void Heap::FinalizeGarbageCollectionImpl(StackState stack_state) {
   // for old objects are registered in the remembered set.
   if (generational_gc_enabled_) {
     HeapBase::EnableGenerationalGC();
+    growing_.EnableMinorGCs();
   }
 #endif  // defined(CPPGC_YOUNG_GENERATION)
   {
@@ -213,7 +213,7 @@ bool ObjectAllocator::TryRefillLinearAllocationBuffer(NormalPageSpace& space,
   // tested from larger sizes that are guaranteed to fit the block to smaller
   // bucket sizes that may only potentially fit the block. For the bucket that
   // may exactly fit the allocation of `size` bytes (no overallocation), only
-  // the first entry is checked.
+  // the first few entries are checked.
   if (sweeper.SweepForAllocationIfRunning(
           &space, size, v8::base::TimeDelta::FromMicroseconds(500)) &&
       TryRefillLinearAllocationBufferFromFreeList(space, size)) {
@@ -143,7 +143,10 @@ RawHeap::RegularSpaceType ObjectAllocator::GetInitialSpaceIndexForSize(
     return RawHeap::RegularSpaceType::kNormal2;
   }
   if (size < 128) return RawHeap::RegularSpaceType::kNormal3;
-  return RawHeap::RegularSpaceType::kNormal4;
+  // Keep medium-sized objects apart from larger ones, so that the holes they
+  // leave behind are reused by objects of similar size.
+  if (size < 512) return RawHeap::RegularSpaceType::kNormal4;
+  return RawHeap::RegularSpaceType::kNormal5;
 }
 
 void* ObjectAllocator::OutOfLineAllocate(NormalPageSpace& space, size_t size,
@@ -26,7 +26,8 @@ class V8_EXPORT_PRIVATE RawHeap final {
   // - kNormal1:  < 32 bytes
   // - kNormal2:  < 64 bytes
   // - kNormal3:  < 128 bytes
-  // - kNormal4: >= 128 bytes
+  // - kNormal4:  < 512 bytes
+  // - kNormal5: >= 512 bytes
   //
   // Objects of size greater than 2^16 get stored in the large space.
   //
@@ -37,6 +38,7 @@ class V8_EXPORT_PRIVATE RawHeap final {
     kNormal2,
     kNormal3,
     kNormal4,
+    kNormal5,
     kLarge,
   };
 
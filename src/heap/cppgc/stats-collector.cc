@@ -183,10 +183,11 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
     StatsCollector::SweepingType sweeping_type, int64_t atomic_mark_us,
     int64_t atomic_weak_us, int64_t atomic_compact_us, int64_t atomic_sweep_us,
     int64_t incremental_mark_us, int64_t incremental_sweep_us,
-    int64_t concurrent_mark_us, int64_t concurrent_sweep_us,
-    int64_t objects_before_bytes, int64_t objects_after_bytes,
-    int64_t objects_freed_bytes, int64_t memory_before_bytes,
-    int64_t memory_after_bytes, int64_t memory_freed_bytes) {
+    int64_t concurrent_mark_us, int64_t concurrent_compact_us,
+    int64_t concurrent_sweep_us, int64_t objects_before_bytes,
+    int64_t objects_after_bytes, int64_t objects_freed_bytes,
+    int64_t memory_before_bytes, int64_t memory_after_bytes,
+    int64_t memory_freed_bytes) {
   MetricRecorder::GCCycle event;
   event.type = (type == CollectionType::kMajor)
                    ? MetricRecorder::GCCycle::Type::kMajor
@@ -217,7 +218,8 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
   event.total.mark_duration_us =
       event.main_thread.mark_duration_us + concurrent_mark_us;
   event.total.weak_duration_us = event.main_thread.weak_duration_us;
-  event.total.compact_duration_us = event.main_thread.compact_duration_us;
+  event.total.compact_duration_us =
+      event.main_thread.compact_duration_us + concurrent_compact_us;
   event.total.sweep_duration_us =
       event.main_thread.sweep_duration_us + concurrent_sweep_us;
   // Objects:
@@ -258,6 +260,12 @@ MetricRecorder::GCCycle GetCycleEventForMetricRecorder(
 
 }  // namespace
 
+void StatsCollector::NotifySweepOnAllocation(v8::base::TimeDelta duration) {
+  DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
+  current_.sweep_on_allocation_time += duration;
+  current_.sweep_on_allocation_steps++;
+}
+
 void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
   DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
   gc_state_ = GarbageCollectionState::kNotRunning;
@@ -280,6 +288,7 @@ void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
         previous_.scope_data[kIncrementalMark].InMicroseconds(),
         previous_.scope_data[kIncrementalSweep].InMicroseconds(),
         previous_.concurrent_scope_data[kConcurrentMark],
+        previous_.concurrent_scope_data[kConcurrentCompact],
         previous_.concurrent_scope_data[kConcurrentSweep],
         previous_.object_size_before_sweep_bytes /* objects_before */,
         marked_bytes_so_far_ /* objects_after */,
@@ -311,6 +320,11 @@ size_t StatsCollector::marked_bytes_on_current_cycle() const {
   return current_.marked_bytes;
 }
 
+CollectionType StatsCollector::collection_type_of_current_cycle() const {
+  DCHECK_NE(GarbageCollectionState::kNotRunning, gc_state_);
+  return current_.collection_type;
+}
+
 v8::base::TimeDelta StatsCollector::marking_time() const {
   DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
   // During sweeping we refer to the current Event as that already holds the
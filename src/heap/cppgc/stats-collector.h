@@ -59,11 +59,13 @@ namespace internal {
   V(SweepFinishIfOutOfWork)                 \
   V(SweepInvokePreFinalizers)               \
   V(SweepInTask)                            \
+  V(SweepInIdleTask)                        \
   V(SweepInTaskForStatistics)               \
   V(SweepOnAllocation)                      \
   V(SweepFinalize)
 
 #define CPPGC_FOR_ALL_HISTOGRAM_CONCURRENT_SCOPES(V) \
+  V(ConcurrentCompact)                               \
   V(ConcurrentMark)                                  \
   V(ConcurrentSweep)                                 \
   V(ConcurrentWeakCallback)
@@ -120,6 +122,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t marked_bytes = 0;
     size_t object_size_before_sweep_bytes = -1;
     size_t memory_size_before_sweep_bytes = -1;
+    // Time spent sweeping on allocation (part of IncrementalSweep), and the
+    // number of allocations that swept.
+    v8::base::TimeDelta sweep_on_allocation_time;
+    size_t sweep_on_allocation_steps = 0;
   };
 
  private:
@@ -289,6 +295,8 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Indicates the end of a garbage collection cycle. This means that sweeping
   // is finished at this point.
   void NotifySweepingCompleted(SweepingType);
+  // Indicates that an allocation swept for |duration|.
+  void NotifySweepOnAllocation(v8::base::TimeDelta duration);
 
   size_t allocated_memory_size() const;
   // Size of live objects in bytes  on the heap. Based on the most recent marked
@@ -308,6 +316,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // be called during marking.
   v8::base::TimeDelta marking_time() const;
 
+  // Returns the collection type of the current cycle. Should only be called
+  // within GC cycle.
+  CollectionType collection_type_of_current_cycle() const;
+
   double GetRecentAllocationSpeedInBytesPerMs() const;
 
   const Event& GetPreviousEventForTesting() const { return previous_; }
@@ -857,7 +857,17 @@ class Sweeper::SweeperImpl final {
     StatsCollector::EnabledScope inner_scope(
         stats_collector_, StatsCollector::kSweepOnAllocation);
     MutatorThreadSweepingScope sweeping_in_progress(*this);
-    DeadlineChecker deadline_check(v8::base::TimeTicks::Now() + max_duration);
+    const v8::base::TimeTicks start = v8::base::TimeTicks::Now();
+    const bool found_slot =
+        SweepSpaceForAllocation(space_state, size, start + max_duration);
+    stats_collector_->NotifySweepOnAllocation(v8::base::TimeTicks::Now() -
+                                              start);
+    return found_slot;
+  }
+
+  bool SweepSpaceForAllocation(SpaceState& space_state, size_t size,
+                               v8::base::TimeTicks deadline) {
+    DeadlineChecker deadline_check(deadline);
     {
       // First, process unfinalized pages as finalizing a page is faster than
       // sweeping.
@@ -925,7 +935,10 @@ class Sweeper::SweeperImpl final {
   }
 
   void FinishIfOutOfWork() {
+    // With lazy sweeping, the remaining finalizers run on allocation or in
+    // idle time instead.
     if (is_in_progress_ && !is_sweeping_on_mutator_thread_ &&
+        config_.lazy_sweeping == SweepingConfig::LazySweeping::kDisabled &&
         concurrent_sweeper_handle_ && concurrent_sweeper_handle_->IsValid() &&
         !concurrent_sweeper_handle_->IsActive()) {
       StatsCollector::EnabledScope stats_scope(
@@ -1114,6 +1127,44 @@ class Sweeper::SweeperImpl final {
     Handle handle_;
   };
 
+  // Used instead of IncrementalSweepTask for lazy sweeping.
+  class IdleIncrementalSweepTask final : public cppgc::IdleTask {
+   public:
+    using Handle = SingleThreadedHandle;
+
+    explicit IdleIncrementalSweepTask(SweeperImpl& sweeper)
+        : sweeper_(sweeper), handle_(Handle::NonEmptyTag{}) {}
+
+    static Handle Post(SweeperImpl& sweeper, cppgc::TaskRunner* runner) {
+      auto task = std::make_unique<IdleIncrementalSweepTask>(sweeper);
+      auto handle = task->GetHandle();
+      runner->PostIdleTask(std::move(task));
+      return handle;
+    }
+
+   private:
+    void Run(double deadline_in_seconds) override {
+      if (handle_.IsCanceled()) return;
+
+      const auto max_duration = v8::base::TimeDelta::FromSecondsD(
+          deadline_in_seconds -
+          sweeper_.platform_->MonotonicallyIncreasingTime());
+      if (max_duration <= v8::base::TimeDelta() ||
+          !sweeper_.PerformSweepOnMutatorThread(
+              max_duration, StatsCollector::kSweepInIdleTask,
+              sweeper_.IsConcurrentSweepingDone()
+                  ? MutatorThreadSweepingMode::kAll
+                  : MutatorThreadSweepingMode::kOnlyFinalizers)) {
+        sweeper_.ScheduleIncrementalSweeping();
+      }
+    }
+
+    Handle GetHandle() const { return handle_; }
+
+    SweeperImpl& sweeper_;
+    Handle handle_;
+  };
+
   void ScheduleIncrementalSweeping() {
     DCHECK(platform_);
     DCHECK_GE(config_.sweeping_type,
@@ -1122,6 +1173,14 @@ class Sweeper::SweeperImpl final {
     auto runner = platform_->GetForegroundTaskRunner();
     if (!runner) return;
 
+    // Without idle tasks, lazy sweeping falls back to regular tasks so that
+    // finalizers still run eventually.
+    if (config_.lazy_sweeping == SweepingConfig::LazySweeping::kEnabled &&
+        runner->IdleTasksEnabled()) {
+      incremental_sweeper_handle_ =
+          IdleIncrementalSweepTask::Post(*this, runner.get());
+      return;
+    }
     incremental_sweeper_handle_ =
         IncrementalSweepTask::Post(*this, runner.get());
   }
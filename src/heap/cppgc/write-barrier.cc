@@ -135,8 +135,9 @@ void WriteBarrier::GenerationalBarrierSlow(const CagedHeapLocalData& local_data,
   auto& heap = HeapBase::From(*heap_handle);
   if (heap.in_atomic_pause()) return;
 
-  if (value_offset > 0 && age_table.GetAge(value_offset) == AgeTable::Age::kOld)
-    return;
+  // References to old objects are filtered in the inline part of the barrier.
+  DCHECK_IMPLIES(value_offset > 0,
+                 age_table.GetAge(value_offset) != AgeTable::Age::kOld);
 
   // Record slot.
   heap.remembered_set().AddSlot((const_cast<void*>(slot)));
@@ -155,8 +156,9 @@ void WriteBarrier::GenerationalBarrierForUncompressedSlotSlow(
   auto& heap = HeapBase::From(*heap_handle);
   if (heap.in_atomic_pause()) return;
 
-  if (value_offset > 0 && age_table.GetAge(value_offset) == AgeTable::Age::kOld)
-    return;
+  // References to old objects are filtered in the inline part of the barrier.
+  DCHECK_IMPLIES(value_offset > 0,
+                 age_table.GetAge(value_offset) != AgeTable::Age::kOld);
 
   // Record slot.
   heap.remembered_set().AddUncompressedSlot((const_cast<void*>(slot)));
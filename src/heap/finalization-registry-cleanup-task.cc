@@ -4,6 +4,7 @@
 
 #include "src/heap/finalization-registry-cleanup-task.h"
 
+#include "src/base/platform/time.h"
 #include "src/execution/frames.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/execution/stack-guard.h"
@@ -84,9 +85,17 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // of exception, check if the FinalizationRegistry still needs cleanup
   // and should be requeued.
   //
-  // TODO(syg): Implement better scheduling for finalizers.
-  InvokeFinalizationRegistryCleanupFromTask(native_context,
-                                            finalization_registry, callback);
+  // With a time budget, cleanup is also interrupted when the budget is used
+  // up. Requeuing at the end of the dirty list then gives the other dirty
+  // FinalizationRegistries their turn before this one continues.
+  base::TimeTicks deadline;
+  if (v8_flags.finalization_registry_cleanup_task_budget_ms > 0) {
+    deadline = base::TimeTicks::Now() +
+               base::TimeDelta::FromMillisecondsD(
+                   v8_flags.finalization_registry_cleanup_task_budget_ms);
+  }
+  InvokeFinalizationRegistryCleanupFromTask(
+      native_context, finalization_registry, callback, deadline);
   if (finalization_registry->NeedsCleanup() &&
       !finalization_registry->scheduled_for_cleanup()) {
     auto nop = [](Tagged<HeapObject>, ObjectSlot, Tagged<Object>) {};
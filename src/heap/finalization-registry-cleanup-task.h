@@ -14,6 +14,9 @@ namespace internal {
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
 // non-empty. The task processes a single FinalizationRegistry and posts another
 // cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// With --finalization-registry-cleanup-task-budget-ms, a task stops calling
+// cleanup callbacks once its budget is used up, and the FinalizationRegistry is
+// requeued behind the other dirty ones.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
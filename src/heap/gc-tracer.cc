@@ -20,6 +20,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/memory-balancer.h"
 #include "src/heap/spaces.h"
 #include "src/logging/counters.h"
@@ -337,6 +338,9 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
   FetchBackgroundCounters();
 
   const base::TimeDelta duration = current_.end_time - current_.start_time;
+  if (MemoryBalancer::IsPauseTargetModeEnabled()) {
+    heap_->mb_->RecordMainThreadPause(current_.end_time, duration);
+  }
   auto* long_task_stats = heap_->isolate()->GetCurrentLongTaskStats();
   const bool is_young = Heap::IsYoungGenerationCollector(collector);
   if (is_young) {
@@ -672,13 +676,27 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
     incremental_marking_duration_ +=
         base::TimeDelta::FromMillisecondsD(duration);
   }
+  RecordMainThreadStepForPauseTarget(duration);
   ReportIncrementalMarkingStepToRecorder(duration);
 }
 
+void GCTracer::RecordClearedWeakReferences(size_t js_weak_refs,
+                                           size_t weak_cells) {
+  current_.cleared_js_weak_refs += js_weak_refs;
+  current_.cleared_weak_cells += weak_cells;
+}
+
 void GCTracer::AddIncrementalSweepingStep(double duration) {
+  RecordMainThreadStepForPauseTarget(duration);
   ReportIncrementalSweepingStepToRecorder(duration);
 }
 
+void GCTracer::RecordMainThreadStepForPauseTarget(double duration) {
+  if (!MemoryBalancer::IsPauseTargetModeEnabled()) return;
+  heap_->mb_->RecordMainThreadPause(
+      base::TimeTicks::Now(), base::TimeDelta::FromMillisecondsD(duration));
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (v8_flags.trace_gc) {
     va_list arguments;
@@ -756,6 +774,16 @@ void GCTracer::PrintNVP() const {
         current_.end_time - incremental_marking_start_time_;
   }
 
+  MemoryAllocator::HugePageStats data_huge_pages;
+  MemoryAllocator::HugePageStats code_huge_pages;
+  if (current_.type == Event::Type::MARK_COMPACTOR ||
+      current_.type == Event::Type::INCREMENTAL_MARK_COMPACTOR) {
+    data_huge_pages =
+        heap_->memory_allocator()->ComputeHugePageStats(NOT_EXECUTABLE);
+    code_huge_pages =
+        heap_->memory_allocator()->ComputeHugePageStats(EXECUTABLE);
+  }
+
   // Avoid data races when printing the background scopes.
   base::MutexGuard guard(&background_scopes_mutex_);
 
@@ -1030,6 +1058,12 @@ void GCTracer::PrintNVP() const {
           "new_space_survive_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "unmapper_chunks=%d "
+          "huge_page_regions=%zu "
+          "huge_page_regions_complete=%zu "
+          "code_huge_page_regions=%zu "
+          "code_huge_page_regions_complete=%zu "
+          "cleared_js_weak_refs=%zu "
+          "cleared_weak_cells=%zu "
           "compaction_speed=%.f\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
@@ -1115,6 +1149,9 @@ void GCTracer::PrintNVP() const {
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->unmapper()->NumberOfChunks(),
+          data_huge_pages.regions, data_huge_pages.complete_regions,
+          code_huge_pages.regions, code_huge_pages.complete_regions,
+          current_.cleared_js_weak_refs, current_.cleared_weak_cells,
           CompactionSpeedInBytesPerMillisecond());
       break;
     case Event::Type::START:
@@ -1639,6 +1676,11 @@ void GCTracer::ReportFullCycleToRecorder() {
   // - event.main_thread_efficiency_in_bytes_per_us
 
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+
+  if (MemoryBalancer::IsPauseTargetModeEnabled()) {
+    recorder->AddMainThreadEvent(heap_->mb_->ExtractMutatorUtilizationEvent(),
+                                 GetContextId(heap_->isolate()));
+  }
 }
 
 void GCTracer::ReportIncrementalMarkingStepToRecorder(double v8_duration) {
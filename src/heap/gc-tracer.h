@@ -219,6 +219,10 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Bytes marked incrementally for INCREMENTAL_MARK_COMPACTOR
     size_t incremental_marking_bytes = 0;
 
+    // Number of JSWeakRefs and WeakCells whose target died in this cycle.
+    size_t cleared_js_weak_refs = 0;
+    size_t cleared_weak_cells = 0;
+
     // Duration (in ms) of incremental marking steps for
     // INCREMENTAL_MARK_COMPACTOR.
     base::TimeDelta incremental_marking_duration;
@@ -334,6 +338,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalSweepingStep(double duration);
 
+  // Log the JSWeakRefs and WeakCells cleared by the current GC.
+  void RecordClearedWeakReferences(size_t js_weak_refs, size_t weak_cells);
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns a conservative value if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
@@ -486,6 +493,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void FetchBackgroundCounters();
 
+  // Accounts an incremental step of |duration| ms that just ended against the
+  // pause budget of --gc-pause-target.
+  void RecordMainThreadStepForPauseTarget(double duration);
+
   void ReportFullCycleToRecorder();
   void ReportIncrementalMarkingStepToRecorder(double v8_duration);
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
@@ -590,6 +601,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, BackgroundScavengerScope);
   FRIEND_TEST(GCTracerTest, BackgroundMinorMSScope);
   FRIEND_TEST(GCTracerTest, BackgroundMajorMCScope);
+  FRIEND_TEST(GCTracerTest, ClearedWeakReferences);
   FRIEND_TEST(GCTracerTest, EmbedderAllocationThroughput);
   FRIEND_TEST(GCTracerTest, MultithreadedBackgroundScope);
   FRIEND_TEST(GCTracerTest, NewSpaceAllocationThroughput);
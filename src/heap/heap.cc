@@ -21,6 +21,7 @@
 #include "src/base/optional.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/sys-info.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
@@ -93,6 +94,7 @@
 #include "src/heap/stress-scavenge-observer.h"
 #include "src/heap/sweeper.h"
 #include "src/heap/trusted-range.h"
+#include "src/heap/young-generation-sizer.h"
 #include "src/heap/zapping.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/v8.h"
@@ -1399,6 +1401,16 @@ void Heap::GarbageCollectionEpilogueInSafepoint(GarbageCollector collector) {
   DCHECK_IMPLIES(collector == GarbageCollector::MARK_COMPACTOR,
                  !memory_allocator()->unmapper()->IsRunning());
 
+  if (v8_flags.huge_pages) {
+    // Keep a few freed pages committed for reuse, unless the heap should
+    // reduce its memory usage.
+    memory_allocator()->unmapper()->SetMaxCommittedPooledChunks(
+        ShouldReduceMemory() || ShouldOptimizeForMemoryUsage()
+            ? 0
+            : v8_flags.huge_pages_max_committed_pool_size_mb * MB /
+                  Page::kPageSize);
+  }
+
   // Start concurrent unmapper tasks to free pages queued during GC.
   memory_allocator()->unmapper()->FreeQueuedChunks();
 
@@ -2707,6 +2719,9 @@ void Heap::MarkCompact() {
 
   if (v8_flags.allocation_site_pretenuring) {
     EvaluateOldSpaceLocalPretenuring(size_of_objects_before_gc);
+    if (v8_flags.allocation_site_pretenuring_decay) {
+      pretenuring_handler_.DecayPretenuringDecisions();
+    }
   }
   // This should be updated before PostGarbageCollectionProcessing, which
   // can cause another GC. Take into account the objects promoted during
@@ -3835,11 +3850,19 @@ void Heap::ActivateMemoryReducerIfNeededOnMainThread() {
 }
 
 Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
+  // Unless the adaptive sizing below picks a capacity, new space shrinks back
+  // to its initial capacity and grows by --semi-space-growth-factor.
+  new_space_resize_target_ = initial_semispace_size_;
+
   if (ShouldReduceMemory()) {
     return (v8_flags.predictable) ? ResizeNewSpaceMode::kNone
                                   : ResizeNewSpaceMode::kShrink;
   }
 
+  if (v8_flags.adaptive_young_generation) {
+    return ShouldResizeNewSpaceAdaptively();
+  }
+
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
@@ -3847,27 +3870,76 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
                              (allocation_throughput != 0) &&
                              (allocation_throughput < kLowAllocationThroughput);
 
-  const bool should_grow =
+  bool should_grow =
       (new_space_->TotalCapacity() < new_space_->MaximumCapacity()) &&
       (survived_since_last_expansion_ > new_space_->TotalCapacity());
 
-  if (should_grow) survived_since_last_expansion_ = 0;
+  if (MemoryBalancer::IsPauseTargetModeEnabled()) {
+    // Keep the young generation small enough for a scavenge of a full new
+    // space to fit into the pause budget.
+    const double scavenge_speed = tracer_->ScavengeSpeedInBytesPerMillisecond();
+    if (scavenge_speed != 0) {
+      const double budget_ms = MemoryBalancer::PauseBudget().InMillisecondsF();
+      const double capacity = new_space_->TotalCapacity();
+      if (capacity * v8_flags.semi_space_growth_factor / scavenge_speed >
+          budget_ms) {
+        should_grow = false;
+      }
+      if (!v8_flags.predictable && capacity / scavenge_speed > budget_ms) {
+        return ResizeNewSpaceMode::kShrink;
+      }
+    }
+  }
+
+  if (should_grow) {
+    survived_since_last_expansion_ = 0;
+    new_space_resize_target_ =
+        v8_flags.semi_space_growth_factor * new_space_->TotalCapacity();
+  }
 
   if (should_grow == should_shrink) return ResizeNewSpaceMode::kNone;
   return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
 }
 
+Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpaceAdaptively() {
+  double max_pause_ms = v8_flags.adaptive_young_generation_max_pause_ms;
+  if (MemoryBalancer::IsPauseTargetModeEnabled()) {
+    max_pause_ms =
+        std::min(max_pause_ms, MemoryBalancer::PauseBudget().InMillisecondsF());
+  }
+  const size_t capacity = new_space_->TotalCapacity();
+  const size_t target = YoungGenerationSizer::TargetCapacity(
+      tracer_->NewSpaceAllocationThroughputInBytesPerMillisecond(
+          GCTracer::kThroughputTimeFrame),
+      tracer_->AverageSurvivalRatio() / 100,
+      tracer_->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects),
+      max_pause_ms, capacity, initial_semispace_size_,
+      new_space_->MaximumCapacity());
+  if (v8_flags.trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Adaptive young generation: capacity=%zuKB target=%zuKB\n",
+        capacity / KB, target / KB);
+  }
+  new_space_resize_target_ = target;
+  if (target > capacity) return ResizeNewSpaceMode::kGrow;
+  // Don't shrink for small differences, as growing again is expensive.
+  if (!v8_flags.predictable && target < capacity / 2) {
+    return ResizeNewSpaceMode::kShrink;
+  }
+  return ResizeNewSpaceMode::kNone;
+}
+
 void Heap::ExpandNewSpaceSize() {
   // Grow the size of new space if there is room to grow, and enough data
   // has survived scavenge since the last expansion.
-  new_space_->Grow();
+  new_space_->GrowTo(new_space_resize_target_);
   new_lo_space()->SetCapacity(new_space()->TotalCapacity());
 }
 
 void Heap::ReduceNewSpaceSize() {
   // MinorMS shrinks new space as part of sweeping.
   if (!v8_flags.minor_ms) {
-    SemiSpaceNewSpace::From(new_space())->Shrink();
+    SemiSpaceNewSpace::From(new_space())->ShrinkTo(new_space_resize_target_);
   } else {
     paged_new_space()->FinishShrinking();
   }
@@ -4899,6 +4971,12 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints,
   // Initialize max_semi_space_size_.
   {
     max_semi_space_size_ = DefaultMaxSemiSpaceSize();
+    if (v8_flags.adaptive_young_generation) {
+      // Large hosts can afford a much larger young generation, which the
+      // adaptive sizing only grows into when the workload needs it.
+      max_semi_space_size_ = YoungGenerationSizer::MaxSemiSpaceSize(
+          base::SysInfo::AmountOfPhysicalMemory());
+    }
     if (constraints.max_young_generation_size_in_bytes() > 0) {
       max_semi_space_size_ = SemiSpaceSizeFromYoungGenerationSize(
           constraints.max_young_generation_size_in_bytes());
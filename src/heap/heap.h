@@ -1791,7 +1791,10 @@ class Heap final {
   bool HasLowEmbedderAllocationRate();
 
   enum class ResizeNewSpaceMode { kShrink, kGrow, kNone };
+  // Also sets the capacity to grow or shrink new space to.
   ResizeNewSpaceMode ShouldResizeNewSpace();
+  ResizeNewSpaceMode ShouldResizeNewSpaceAdaptively();
+  size_t new_space_resize_target() const { return new_space_resize_target_; }
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
@@ -2102,6 +2105,9 @@ class Heap final {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  // The capacity that the last call to ShouldResizeNewSpace() picked.
+  size_t new_space_resize_target_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
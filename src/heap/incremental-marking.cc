@@ -25,6 +25,7 @@
 #include "src/heap/marking-visitor-inl.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/memory-chunk-layout.h"
+#include "src/heap/memory-balancer.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/minor-mark-sweep.h"
 #include "src/heap/objects-visiting-inl.h"
@@ -51,6 +52,10 @@ static constexpr v8::base::TimeDelta kMaxStepSizeOnTask =
     v8::base::TimeDelta::FromMilliseconds(1);
 static constexpr v8::base::TimeDelta kMaxStepSizeOnAllocation =
     v8::base::TimeDelta::FromMilliseconds(5);
+// Steps still make progress when the pause budget of --gc-pause-target is
+// exhausted, so that marking eventually finishes.
+static constexpr v8::base::TimeDelta kMinStepSizeForPauseTarget =
+    v8::base::TimeDelta::FromMicroseconds(100);
 
 #ifndef DEBUG
 static constexpr size_t kV8ActivationThreshold = 8 * MB;
@@ -700,6 +705,16 @@ bool IncrementalMarking::TryInitializeTaskTimeout() {
   return delaying;
 }
 
+base::TimeDelta IncrementalMarking::GetMaxStepDuration(
+    StepOrigin step_origin) {
+  const base::TimeDelta max_duration = GetMaxDuration(step_origin);
+  if (!MemoryBalancer::IsPauseTargetModeEnabled()) return max_duration;
+  return std::min(
+      max_duration,
+      std::max(kMinStepSizeForPauseTarget,
+               heap_->mb_->RemainingPauseBudget(base::TimeTicks::Now())));
+}
+
 size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
   FetchBytesMarkedConcurrently();
   // TODO(v8:14140): Consider the size including young generation here as well
@@ -726,7 +741,7 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
-  Step(GetMaxDuration(StepOrigin::kTask), max_bytes_to_process,
+  Step(GetMaxStepDuration(StepOrigin::kTask), max_bytes_to_process,
        StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
     heap()->FinalizeIncrementalMarkingAtomically(
@@ -770,7 +785,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK(IsMajorMarking());
 
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kV8);
-  Step(GetMaxDuration(StepOrigin::kV8), max_bytes_to_process, StepOrigin::kV8);
+  Step(GetMaxStepDuration(StepOrigin::kV8), max_bytes_to_process,
+       StepOrigin::kV8);
 
   // Bail out when an AlwaysAllocateScope is active as the assumption is that
   // there's no GC being triggered. Check this condition at last position to
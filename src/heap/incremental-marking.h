@@ -166,6 +166,8 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
 
   // Fetches marked byte counters from the concurrent marker.
   void FetchBytesMarkedConcurrently();
+  // The time a step may take, which --gc-pause-target further limits.
+  base::TimeDelta GetMaxStepDuration(StepOrigin step_origin);
   size_t GetScheduledBytes(StepOrigin step_origin);
 
   bool ShouldFinalize() const;
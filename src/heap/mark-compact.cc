@@ -3414,11 +3414,14 @@ void MarkCompactCollector::ClearWeakReferences() {
 void MarkCompactCollector::ClearJSWeakRefs() {
   Tagged<JSWeakRef> weak_ref;
   Isolate* const isolate = heap_->isolate();
+  size_t cleared_js_weak_refs = 0;
+  size_t cleared_weak_cells = 0;
   while (local_weak_objects()->js_weak_refs_local.Pop(&weak_ref)) {
     Tagged<HeapObject> target = HeapObject::cast(weak_ref->target());
     if (!target.InReadOnlySpace() &&
         !non_atomic_marking_state_->IsMarked(target)) {
       weak_ref->set_target(ReadOnlyRoots(isolate).undefined_value());
+      cleared_js_weak_refs++;
     } else {
       // The value of the JSWeakRef is alive.
       ObjectSlot slot = weak_ref->RawField(JSWeakRef::kTargetOffset);
@@ -3448,6 +3451,7 @@ void MarkCompactCollector::ClearJSWeakRefs() {
       // during GC; thus we need to record the slots it writes. The normal write
       // barrier is not enough, since it's disabled before GC.
       weak_cell->Nullify(isolate, gc_notify_updated_slot);
+      cleared_weak_cells++;
       DCHECK(finalization_registry->NeedsCleanup());
       DCHECK(finalization_registry->scheduled_for_cleanup());
     } else {
@@ -3477,6 +3481,8 @@ void MarkCompactCollector::ClearJSWeakRefs() {
       RecordSlot(weak_cell, slot, HeapObject::cast(*slot));
     }
   }
+  heap_->tracer()->RecordClearedWeakReferences(cleared_js_weak_refs,
+                                               cleared_weak_cells);
   heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
 }
 
@@ -4339,6 +4345,10 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     }
   }
 
+  if (v8_flags.evacuation_pause_budget_ms > 0) {
+    AbortEvacuationCandidatesOverPauseBudget(live_bytes);
+  }
+
   for (Page* page : old_space_evacuation_pages_) {
     if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) continue;
 
@@ -4380,6 +4390,50 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   }
 }
 
+void MarkCompactCollector::AbortEvacuationCandidatesOverPauseBudget(
+    size_t young_live_bytes) {
+  // Only latency-critical GCs are bounded; GCs that should reduce memory and
+  // the stress modes evacuate all of their candidates.
+  if (heap_->ShouldReduceMemory() || heap_->ShouldOptimizeForMemoryUsage() ||
+      v8_flags.stress_compaction || v8_flags.stress_compaction_random ||
+      v8_flags.compact_on_every_full_gc) {
+    return;
+  }
+  // The compaction speed is measured per evacuation task.
+  const double compaction_speed =
+      heap_->tracer()->CompactionSpeedInBytesPerMillisecond();
+  if (compaction_speed == 0) return;
+  const double budget = compaction_speed *
+                        v8_flags.evacuation_pause_budget_ms *
+                        NumberOfParallelCompactionTasks(heap_);
+  // Young generation pages can't be aborted, so they use up the budget first.
+  // Candidates with fewer live bytes free the same page for less work, so
+  // they are kept in favor of the others.
+  std::vector<Page*> candidates;
+  for (Page* page : old_space_evacuation_pages_) {
+    if (!page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) {
+      candidates.push_back(page);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [](Page* a, Page* b) {
+    return a->live_bytes() < b->live_bytes();
+  });
+  double evacuated_bytes = static_cast<double>(young_live_bytes);
+  size_t aborted_pages = 0;
+  for (Page* page : candidates) {
+    evacuated_bytes += page->live_bytes();
+    if (evacuated_bytes <= budget) continue;
+    ReportAbortedEvacuationCandidateDueToFlags(page->area_start(), page);
+    aborted_pages++;
+  }
+  if (v8_flags.trace_evacuation && aborted_pages > 0) {
+    PrintIsolate(heap_->isolate(),
+                 "evacuation-pause-budget: budget=%.f bytes candidates=%zu "
+                 "aborted=%zu\n",
+                 budget, candidates.size(), aborted_pages);
+  }
+}
+
 class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
  public:
   Tagged<Object> RetainAs(Tagged<Object> object) override {
@@ -5065,7 +5119,7 @@ void MarkCompactCollector::StartSweepNewSpace() {
   DCHECK_EQ(Heap::ResizeNewSpaceMode::kNone, resize_new_space_);
   resize_new_space_ = heap_->ShouldResizeNewSpace();
   if (resize_new_space_ == Heap::ResizeNewSpaceMode::kShrink) {
-    paged_space->StartShrinking();
+    paged_space->StartShrinking(heap_->new_space_resize_target());
   }
 
   DCHECK(empty_new_space_pages_to_be_swept_.empty());
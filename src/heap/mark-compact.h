@@ -311,6 +311,10 @@ class MarkCompactCollector final {
   void EvacuateEpilogue();
   void Evacuate();
   void EvacuatePagesInParallel();
+  // Aborts evacuation of the old generation candidates that don't fit into
+  // --evacuation-pause-budget-ms, given the live bytes that are evacuated
+  // anyway. The pages stay in place and are considered again in the next GC.
+  void AbortEvacuationCandidatesOverPauseBudget(size_t young_live_bytes);
   void UpdatePointersAfterEvacuation();
 
   void ReleaseEvacuationCandidates();
@@ -5,6 +5,7 @@
 #include "src/heap/memory-allocator.h"
 
 #include <cinttypes>
+#include <unordered_map>
 
 #include "src/base/address-region.h"
 #include "src/common/globals.h"
@@ -17,6 +18,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/read-only-spaces.h"
+#include "src/heap/spaces-inl.h"
 #include "src/heap/zapping.h"
 #include "src/logging/log.h"
 #include "src/utils/allocation.h"
@@ -177,21 +179,55 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
   while ((chunk = GetMemoryChunkSafe(ChunkQueueType::kRegular)) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
     allocator_->PerformFreeMemory(chunk);
-    if (pooled) AddMemoryChunkSafe(ChunkQueueType::kPooled, chunk);
+    if (pooled) AddPooledMemoryChunkSafe(chunk);
     if (delegate && delegate->ShouldYield()) return;
   }
   if (mode == MemoryAllocator::Unmapper::FreeMode::kFreePooled) {
-    // The previous loop uncommitted any pages marked as pooled and added them
-    // to the pooled list. In case of kFreePooled we need to free them though as
-    // well.
-    while ((chunk = GetMemoryChunkSafe(ChunkQueueType::kPooled)) != nullptr) {
-      allocator_->FreePooledChunk(chunk);
-      if (delegate && delegate->ShouldYield()) return;
+    // The previous loop added any pages marked as pooled to the pooled lists.
+    // In case of kFreePooled we need to free them though as well.
+    for (ChunkQueueType type : {ChunkQueueType::kPooledCommitted,
+                                ChunkQueueType::kPooled}) {
+      while ((chunk = GetMemoryChunkSafe(type)) != nullptr) {
+        allocator_->FreePooledChunk(chunk);
+        if (delegate && delegate->ShouldYield()) return;
+      }
     }
   }
   PerformFreeMemoryOnQueuedNonRegularChunks();
 }
 
+void MemoryAllocator::Unmapper::AddPooledMemoryChunkSafe(MemoryChunk* chunk) {
+  {
+    base::MutexGuard guard(&mutex_);
+    if (chunks_[ChunkQueueType::kPooledCommitted].size() <
+        max_committed_pooled_chunks_) {
+      chunks_[ChunkQueueType::kPooledCommitted].push_back(chunk);
+      return;
+    }
+  }
+  allocator_->UncommitMemory(chunk->reserved_memory());
+  AddMemoryChunkSafe(ChunkQueueType::kPooled, chunk);
+}
+
+void MemoryAllocator::Unmapper::SetMaxCommittedPooledChunks(
+    size_t max_chunks) {
+  std::vector<MemoryChunk*> chunks_to_uncommit;
+  {
+    base::MutexGuard guard(&mutex_);
+    max_committed_pooled_chunks_ = max_chunks;
+    std::vector<MemoryChunk*>& committed =
+        chunks_[ChunkQueueType::kPooledCommitted];
+    while (committed.size() > max_chunks) {
+      chunks_to_uncommit.push_back(committed.back());
+      committed.pop_back();
+    }
+  }
+  for (MemoryChunk* chunk : chunks_to_uncommit) {
+    allocator_->UncommitMemory(chunk->reserved_memory());
+    AddMemoryChunkSafe(ChunkQueueType::kPooled, chunk);
+  }
+}
+
 void MemoryAllocator::Unmapper::TearDown() {
   CHECK(!job_handle_ || !job_handle_->IsValid());
   PerformFreeMemoryOnQueuedChunks(FreeMode::kFreePooled);
@@ -218,9 +254,10 @@ int MemoryAllocator::Unmapper::NumberOfChunks() {
 size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   base::MutexGuard guard(&mutex_);
 
-  size_t sum = 0;
   // kPooled chunks are already uncommited. We only have to account for
-  // kRegular and kNonRegular chunks.
+  // kRegular, kNonRegular and kPooledCommitted chunks.
+  size_t sum = chunks_[ChunkQueueType::kPooledCommitted].size() *
+               MemoryChunk::kPageSize;
   for (auto& chunk : chunks_[ChunkQueueType::kRegular]) {
     sum += chunk->size();
   }
@@ -301,6 +338,12 @@ Address MemoryAllocator::AllocateAlignedMemory(
     if (reservation.SetPermissions(base, commit_size,
                                    PageAllocator::kReadWrite)) {
       UpdateAllocatedSpaceLimits(base, base + commit_size, NOT_EXECUTABLE);
+      if (v8_flags.huge_pages) {
+        // Pages that were freed in the cage before lost the advice that was
+        // given for the whole cage, since freeing remaps them.
+        reservation.page_allocator()->AdviseHugePages(
+            reinterpret_cast<void*>(base), commit_size);
+      }
     } else {
       return HandleAllocationFailure(NOT_EXECUTABLE);
     }
@@ -551,9 +594,9 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   chunk->ReleaseAllAllocatedMemory();
 
   VirtualMemory* reservation = chunk->reserved_memory();
-  if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
-    UncommitMemory(reservation);
-  } else {
+  // Pooled chunks are uncommitted by the Unmapper when they are added to the
+  // pool, unless they are kept committed.
+  if (!chunk->IsFlagSet(MemoryChunk::POOLED)) {
     DCHECK(reservation->IsReserved());
     reservation->Free();
   }
@@ -565,6 +608,14 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
   } else {
     RecordNormalPageDestroyed(*Page::cast(chunk));
   }
+  // With huge pages, old space pages are pooled as well, so that their memory
+  // is reused instead of being returned to the OS.
+  if (mode == FreeMode::kConcurrently && v8_flags.huge_pages &&
+      !chunk->IsLargePage() && chunk->owner() != nullptr &&
+      chunk->owner_identity() == OLD_SPACE &&
+      chunk->size() == static_cast<size_t>(MemoryChunk::kPageSize)) {
+    mode = FreeMode::kConcurrentlyAndPool;
+  }
   switch (mode) {
     case FreeMode::kImmediately:
       PreFreeMemory(chunk);
@@ -584,8 +635,8 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
 }
 
 void MemoryAllocator::FreePooledChunk(MemoryChunk* chunk) {
-  // Pooled pages cannot be touched anymore as their memory is uncommitted.
-  // Pooled pages are not-executable.
+  // Pooled pages cannot be touched anymore as their memory may be
+  // uncommitted. Pooled pages are not-executable.
   FreeMemoryRegion(data_page_allocator(), chunk->address(),
                    static_cast<size_t>(MemoryChunk::kPageSize));
 }
@@ -595,6 +646,14 @@ Page* MemoryAllocator::AllocatePage(MemoryAllocator::AllocationMode alloc_mode,
   size_t size =
       MemoryChunkLayout::AllocatableMemoryInMemoryChunk(space->identity());
   base::Optional<MemoryChunkAllocationResult> chunk_info;
+  if (v8_flags.huge_pages && space->identity() == OLD_SPACE) {
+    // Note that the pool only reuses freed pages where they are. New pages are
+    // still reserved one at a time, and not carved from huge page sized and
+    // aligned regions, so a huge page can only back them if the page allocator
+    // happens to place enough of them next to each other. See
+    // ComputeHugePageStats() for how many of them it did.
+    alloc_mode = AllocationMode::kUsePool;
+  }
   if (alloc_mode == AllocationMode::kUsePool) {
     DCHECK_EQ(size, static_cast<size_t>(
                         MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
@@ -809,6 +868,29 @@ bool MemoryAllocator::SetPermissionsOnExecutableMemoryChunk(VirtualMemory* vm,
   return false;
 }
 
+MemoryAllocator::HugePageStats MemoryAllocator::ComputeHugePageStats(
+    Executability executable) {
+  std::unordered_map<Address, size_t> bytes_per_region;
+  MemoryChunkIterator it(isolate_->heap());
+  while (it.HasNext()) {
+    MemoryChunk* chunk = it.Next();
+    if (chunk->executable() != executable) continue;
+    const Address start = chunk->address();
+    const Address end = start + chunk->size();
+    for (Address region = RoundDown(start, kHugePageRegionSize); region < end;
+         region += kHugePageRegionSize) {
+      bytes_per_region[region] +=
+          std::min(end, region + kHugePageRegionSize) - std::max(start, region);
+    }
+  }
+  HugePageStats stats;
+  stats.regions = bytes_per_region.size();
+  for (const auto& [region, bytes] : bytes_per_region) {
+    if (bytes == kHugePageRegionSize) stats.complete_regions++;
+  }
+  return stats;
+}
+
 #if defined(V8_ENABLE_CONSERVATIVE_STACK_SCANNING) || defined(DEBUG)
 
 const BasicMemoryChunk* MemoryAllocator::LookupChunkContainingAddress(
@@ -66,11 +66,13 @@ class MemoryAllocator {
 
     MemoryChunk* TryGetPooledMemoryChunkSafe() {
       // Procedure:
-      // (1) Try to get a chunk that was declared as pooled and already has
+      // (1) Try to get a pooled chunk that was kept committed.
+      // (2) Try to get a chunk that was declared as pooled and already has
       // been uncommitted.
-      // (2) Try to steal any memory chunk of kPageSize that would've been
+      // (3) Try to steal any memory chunk of kPageSize that would've been
       // uncommitted.
-      MemoryChunk* chunk = GetMemoryChunkSafe(ChunkQueueType::kPooled);
+      MemoryChunk* chunk = GetMemoryChunkSafe(ChunkQueueType::kPooledCommitted);
+      if (chunk == nullptr) chunk = GetMemoryChunkSafe(ChunkQueueType::kPooled);
       if (chunk == nullptr) {
         chunk = GetMemoryChunkSafe(ChunkQueueType::kRegular);
         if (chunk != nullptr) {
@@ -90,6 +92,12 @@ class MemoryAllocator {
     V8_EXPORT_PRIVATE int NumberOfChunks();
     size_t CommittedBufferedMemory();
 
+    // Pooled chunks are uncommitted, except for up to `max_chunks` chunks
+    // that stay committed with --huge-pages, so that the huge pages backing
+    // them are not split. Chunks that are committed beyond the new limit are
+    // uncommitted right away.
+    V8_EXPORT_PRIVATE void SetMaxCommittedPooledChunks(size_t max_chunks);
+
     // Returns true when Unmapper task may be running.
     bool IsRunning() const;
 
@@ -98,10 +106,12 @@ class MemoryAllocator {
     static const int kMaxUnmapperTasks = 4;
 
     enum ChunkQueueType {
-      kRegular,     // Pages of kPageSize that do not live in a CodeRange or
-                    // TrustedRange and can thus be used for stealing.
-      kNonRegular,  // Large chunks and executable chunks.
-      kPooled,      // Pooled chunks, already freed and ready for reuse.
+      kRegular,          // Pages of kPageSize that do not live in a
+                         // CodeRange or TrustedRange and can thus be used for
+                         // stealing.
+      kNonRegular,       // Large chunks and executable chunks.
+      kPooled,           // Pooled chunks, already freed and ready for reuse.
+      kPooledCommitted,  // Pooled chunks that were kept committed.
       kNumberOfChunkQueues,
     };
 
@@ -126,6 +136,10 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Adds a freed chunk to the pool, and uncommits it unless it can be kept
+    // committed.
+    void AddPooledMemoryChunkSafe(MemoryChunk* chunk);
+
     bool MakeRoomForNewTasks();
 
     void PerformFreeMemoryOnQueuedChunks(FreeMode mode,
@@ -138,6 +152,7 @@ class MemoryAllocator {
     MemoryAllocator* const allocator_;
     base::Mutex mutex_;
     std::vector<MemoryChunk*> chunks_[ChunkQueueType::kNumberOfChunkQueues];
+    size_t max_committed_pooled_chunks_ = 0;
     std::unique_ptr<v8::JobHandle> job_handle_;
 
     friend class MemoryAllocator;
@@ -303,6 +318,24 @@ class MemoryAllocator {
       Address addr) const;
 #endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING || DEBUG
 
+  // The size of the huge pages that --huge-pages asks the OS for. Heap pages
+  // are not reserved in regions of this size and alignment.
+  static constexpr size_t kHugePageRegionSize = size_t{2} * MB;
+
+  struct HugePageStats {
+    // Huge page sized and aligned regions that contain heap pages, i.e. the
+    // number of TLB entries needed to map the heap with huge pages.
+    size_t regions = 0;
+    // Regions that are completely covered by heap pages and can thus actually
+    // be backed by huge pages.
+    size_t complete_regions = 0;
+  };
+
+  // Computes the huge page stats for either the executable (code) or the
+  // non-executable (data) pages of the heap, as an indicator of iTLB and dTLB
+  // pressure.
+  HugePageStats ComputeHugePageStats(Executability executable);
+
   // Insert and remove normal and large pages that are owned by this heap.
   void RecordNormalPageCreated(const Page& page);
   void RecordNormalPageDestroyed(const Page& page);
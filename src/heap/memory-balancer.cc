@@ -4,6 +4,9 @@
 
 #include "src/heap/memory-balancer.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 
@@ -39,6 +42,29 @@ void MemoryBalancer::RefreshLimit() {
   const size_t minimum_limit = live_memory_after_gc_ + kMinHeapExtraSpace;
 
   size_t new_limit = std::max<size_t>(minimum_limit, computed_limit);
+
+  if (IsPauseTargetModeEnabled()) {
+    // Marking the live memory takes live / gc-speed on the main thread at
+    // worst. For that to be at most (1 - utilization) of the time, the
+    // mutator has to be able to allocate for utilization / (1 - utilization)
+    // times as long until the next GC.
+    const double utilization = MutatorUtilizationTarget();
+    const double gc_duration =
+        live_memory_after_gc_ / major_gc_speed_.value().rate();
+    const double extra_space = gc_duration * utilization / (1 - utilization) *
+                               major_allocation_rate_.value().rate();
+    // The result is capped by the maximum old generation size below anyway,
+    // but must fit into a size_t before that.
+    const double max_extra_space =
+        static_cast<double>(heap_->max_old_generation_size());
+    const size_t pause_target_limit =
+        live_memory_after_gc_ +
+        static_cast<size_t>(std::isfinite(extra_space)
+                                ? std::clamp(extra_space, 0.0, max_extra_space)
+                                : max_extra_space);
+    new_limit = std::max<size_t>(new_limit, pause_target_limit);
+  }
+
   new_limit = std::min<size_t>(new_limit, heap_->max_old_generation_size());
   new_limit = std::max<size_t>(new_limit, heap_->min_old_generation_size());
 
@@ -103,6 +129,75 @@ void MemoryBalancer::PostHeartbeatTask() {
       std::make_unique<HeartbeatTask>(heap_->isolate(), this), 1);
 }
 
+// static
+bool MemoryBalancer::IsPauseTargetModeEnabled() {
+  return v8_flags.gc_pause_target;
+}
+
+// static
+double MemoryBalancer::MutatorUtilizationTarget() {
+  return std::clamp<double>(v8_flags.gc_mutator_utilization, 0.0,
+                            kMaxMutatorUtilization);
+}
+
+// static
+base::TimeDelta MemoryBalancer::PauseBudget() {
+  return base::TimeDelta::FromMillisecondsD(
+      v8_flags.gc_mutator_utilization_window_ms *
+      (1 - MutatorUtilizationTarget()));
+}
+
+base::TimeDelta MemoryBalancer::MainThreadPausesInWindow(base::TimeTicks now) {
+  const base::TimeTicks window_start =
+      now - base::TimeDelta::FromMilliseconds(
+                v8_flags.gc_mutator_utilization_window_ms);
+  while (!main_thread_pauses_.empty() &&
+         main_thread_pauses_.front().end <= window_start) {
+    main_thread_pauses_.pop_front();
+  }
+  base::TimeDelta pauses;
+  for (const MainThreadPause& pause : main_thread_pauses_) {
+    // Only count the part of the pause that overlaps the window.
+    pauses += std::min(pause.duration, pause.end - window_start);
+  }
+  return pauses;
+}
+
+void MemoryBalancer::RecordMainThreadPause(base::TimeTicks end,
+                                           base::TimeDelta duration) {
+  DCHECK(IsPauseTargetModeEnabled());
+  main_thread_pauses_.push_back({end, duration});
+  const double window_ms = v8_flags.gc_mutator_utilization_window_ms;
+  const double utilization = std::max(
+      0.0, 1 - MainThreadPausesInWindow(end).InMillisecondsF() / window_ms);
+  minimum_mutator_utilization_ =
+      std::min(minimum_mutator_utilization_, utilization);
+  if (utilization < MutatorUtilizationTarget()) windows_below_target_++;
+  if (v8_flags.trace_memory_balancer) {
+    heap_->isolate()->PrintWithTimestamp(
+        "MemoryBalancer: pause=%.2lfms mutator-utilization=%.1lf%%\n",
+        duration.InMillisecondsF(), utilization * 100);
+  }
+}
+
+base::TimeDelta MemoryBalancer::RemainingPauseBudget(base::TimeTicks now) {
+  DCHECK(IsPauseTargetModeEnabled());
+  return std::max(base::TimeDelta(),
+                  PauseBudget() - MainThreadPausesInWindow(now));
+}
+
+v8::metrics::GarbageCollectionMutatorUtilization
+MemoryBalancer::ExtractMutatorUtilizationEvent() {
+  DCHECK(IsPauseTargetModeEnabled());
+  v8::metrics::GarbageCollectionMutatorUtilization event;
+  event.target_in_percent = MutatorUtilizationTarget() * 100;
+  event.minimum_in_percent = minimum_mutator_utilization_ * 100;
+  event.windows_below_target = windows_below_target_;
+  minimum_mutator_utilization_ = 1.0;
+  windows_below_target_ = 0;
+  return event;
+}
+
 HeartbeatTask::HeartbeatTask(Isolate* isolate, MemoryBalancer* mb)
     : CancelableTask(isolate), mb_(mb) {}
 
@@ -5,6 +5,9 @@
 #ifndef V8_HEAP_MEMORY_BALANCER_H_
 #define V8_HEAP_MEMORY_BALANCER_H_
 
+#include <deque>
+
+#include "include/v8-metrics.h"
 #include "src/base/platform/time.h"
 #include "src/tasks/cancelable-task.h"
 
@@ -30,6 +33,24 @@ class MemoryBalancer {
 
   void RecomputeLimits(size_t embedder_allocation_limit, base::TimeTicks time);
 
+  // Pause-target mode (--gc-pause-target) budgets the main thread's GC work,
+  // so that the mutator gets at least --gc-mutator-utilization of every
+  // --gc-mutator-utilization-window-ms window.
+  static bool IsPauseTargetModeEnabled();
+  // --gc-mutator-utilization clamped to [0, kMaxMutatorUtilization], so that
+  // the pause budget and the limit computation stay finite.
+  static double MutatorUtilizationTarget();
+  // The main thread GC time allowed per window.
+  static base::TimeDelta PauseBudget();
+
+  // Records a GC pause or incremental GC step on the main thread.
+  void RecordMainThreadPause(base::TimeTicks end, base::TimeDelta duration);
+  // The main thread GC time left in the window that ends at |now|.
+  base::TimeDelta RemainingPauseBudget(base::TimeTicks now);
+  // Returns the mutator utilization observed since the last call.
+  v8::metrics::GarbageCollectionMutatorUtilization
+  ExtractMutatorUtilizationEvent();
+
  private:
   class SmoothedBytesAndDuration {
    public:
@@ -48,11 +69,19 @@ class MemoryBalancer {
     double duration_;
   };
 
+  static constexpr double kMaxMutatorUtilization = 0.99;
   static constexpr double kMajorAllocationDecayRate = 0.95;
   static constexpr double kMajorGCDecayRate = 0.5;
 
+  struct MainThreadPause {
+    base::TimeTicks end;
+    base::TimeDelta duration;
+  };
+
   void RefreshLimit();
   void PostHeartbeatTask();
+  // Main thread GC time in the window that ends at |now|.
+  base::TimeDelta MainThreadPausesInWindow(base::TimeTicks now);
 
   Heap* heap_;
 
@@ -80,6 +109,12 @@ class MemoryBalancer {
   size_t last_measured_memory_ = 0;
   base::TimeTicks last_measured_at_;
   bool heartbeat_task_started_ = false;
+
+  // The main thread pauses that may still overlap the current window, oldest
+  // first, and what was observed at their ends since the last report.
+  std::deque<MainThreadPause> main_thread_pauses_;
+  double minimum_mutator_utilization_ = 1.0;
+  int64_t windows_below_target_ = 0;
 };
 
 class HeartbeatTask : public CancelableTask {
@@ -821,7 +821,7 @@ bool MinorMarkSweepCollector::StartSweepNewSpace() {
   DCHECK_EQ(Heap::ResizeNewSpaceMode::kNone, resize_new_space_);
   resize_new_space_ = heap_->ShouldResizeNewSpace();
   if (resize_new_space_ == Heap::ResizeNewSpaceMode::kShrink) {
-    paged_space->StartShrinking();
+    paged_space->StartShrinking(heap_->new_space_resize_target());
   }
 
   for (auto it = paged_space->begin(); it != paged_space->end();) {
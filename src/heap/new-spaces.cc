@@ -4,6 +4,7 @@
 
 #include "src/heap/new-spaces.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "src/common/globals.h"
@@ -485,12 +486,17 @@ SemiSpaceNewSpace::~SemiSpaceNewSpace() {
 }
 
 void SemiSpaceNewSpace::Grow() {
-  heap()->safepoint()->AssertActive();
   // Double the semispace size but only up to maximum capacity.
+  GrowTo(static_cast<size_t>(v8_flags.semi_space_growth_factor) *
+         TotalCapacity());
+}
+
+void SemiSpaceNewSpace::GrowTo(size_t new_capacity) {
+  heap()->safepoint()->AssertActive();
   DCHECK(TotalCapacity() < MaximumCapacity());
-  size_t new_capacity = std::min(
-      MaximumCapacity(),
-      static_cast<size_t>(v8_flags.semi_space_growth_factor) * TotalCapacity());
+  new_capacity =
+      std::min(MaximumCapacity(), ::RoundUp(new_capacity, Page::kPageSize));
+  DCHECK_GT(new_capacity, TotalCapacity());
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -506,8 +512,10 @@ void SemiSpaceNewSpace::set_age_mark_to_top() {
   to_space_.set_age_mark(allocation_top());
 }
 
-void SemiSpaceNewSpace::Shrink() {
-  size_t new_capacity = std::max(InitialTotalCapacity(), 2 * Size());
+void SemiSpaceNewSpace::Shrink() { ShrinkTo(InitialTotalCapacity()); }
+
+void SemiSpaceNewSpace::ShrinkTo(size_t new_capacity) {
+  new_capacity = std::max({InitialTotalCapacity(), 2 * Size(), new_capacity});
   size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
   if (rounded_new_capacity < TotalCapacity()) {
     to_space_.ShrinkTo(rounded_new_capacity);
@@ -873,20 +881,22 @@ Page* PagedSpaceForNewSpace::InitializePage(MemoryChunk* chunk) {
 }
 
 void PagedSpaceForNewSpace::Grow() {
-  heap()->safepoint()->AssertActive();
   // Double the space size but only up to maximum capacity.
+  GrowTo(static_cast<size_t>(v8_flags.semi_space_growth_factor) *
+         TotalCapacity());
+}
+
+void PagedSpaceForNewSpace::GrowTo(size_t new_capacity) {
+  heap()->safepoint()->AssertActive();
   DCHECK(TotalCapacity() < MaximumCapacity());
   target_capacity_ =
-      std::min(MaximumCapacity(),
-               RoundUp(static_cast<size_t>(v8_flags.semi_space_growth_factor) *
-                           TotalCapacity(),
-                       Page::kPageSize));
+      std::min(MaximumCapacity(), RoundUp(new_capacity, Page::kPageSize));
 }
 
-bool PagedSpaceForNewSpace::StartShrinking() {
+bool PagedSpaceForNewSpace::StartShrinking(size_t new_capacity) {
   DCHECK(heap()->tracer()->IsInAtomicPause());
-  size_t new_target_capacity =
-      RoundUp(std::max(initial_capacity_, 2 * Size()), Page::kPageSize);
+  size_t new_target_capacity = RoundUp(
+      std::max({initial_capacity_, 2 * Size(), new_capacity}), Page::kPageSize);
   if (new_target_capacity > target_capacity_) return false;
   target_capacity_ = new_target_capacity;
   return true;
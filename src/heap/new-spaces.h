@@ -247,6 +247,9 @@ class NewSpace : NON_EXPORTED_BASE(public SpaceWithLinearArea) {
 
   // Grow the capacity of the space.
   virtual void Grow() = 0;
+  // Grow the capacity of the space to |new_capacity|, or to the maximum
+  // capacity if that is lower.
+  virtual void GrowTo(size_t new_capacity) = 0;
 
   virtual void MakeIterable() = 0;
 
@@ -300,9 +303,12 @@ class V8_EXPORT_PRIVATE SemiSpaceNewSpace final : public NewSpace {
   // Grow the capacity of the semispaces.  Assumes that they are not at
   // their maximum capacity.
   void Grow() final;
+  void GrowTo(size_t new_capacity) final;
 
-  // Shrink the capacity of the semispaces.
+  // Shrink the capacity of the semispaces, to the initial capacity or to
+  // |new_capacity|, but never below twice the surviving bytes.
   void Shrink();
+  void ShrinkTo(size_t new_capacity);
 
   // Return the allocated bytes in the active semispace.
   size_t Size() const final;
@@ -513,9 +519,11 @@ class V8_EXPORT_PRIVATE PagedSpaceForNewSpace final : public PagedSpaceBase {
 
   // Grow the capacity of the space.
   void Grow();
+  void GrowTo(size_t new_capacity);
 
-  // Shrink the capacity of the space.
-  bool StartShrinking();
+  // Shrink the capacity of the space, to |new_capacity| but never below the
+  // initial capacity or twice the surviving bytes.
+  bool StartShrinking(size_t new_capacity);
   void FinishShrinking();
 
   size_t AllocatedSinceLastGC() const;
@@ -620,9 +628,12 @@ class V8_EXPORT_PRIVATE PagedNewSpace final : public NewSpace {
 
   // Grow the capacity of the space.
   void Grow() final { paged_space_.Grow(); }
+  void GrowTo(size_t new_capacity) final { paged_space_.GrowTo(new_capacity); }
 
   // Shrink the capacity of the space.
-  bool StartShrinking() { return paged_space_.StartShrinking(); }
+  bool StartShrinking(size_t new_capacity) {
+    return paged_space_.StartShrinking(new_capacity);
+  }
   void FinishShrinking() { paged_space_.FinishShrinking(); }
 
   // Return the allocated bytes in the active space.
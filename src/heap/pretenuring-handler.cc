@@ -37,21 +37,36 @@ double GetPretenuringRatioThreshold(size_t new_space_capacity) {
   return kMinorMSPretenureMaxRatio * kMinorMSMinCapacity / new_space_capacity;
 }
 
+// Starts the tenure age of a site that was just tenured. Sites that are
+// tenured again after their decision decayed keep it for longer, see
+// PretenuringHandler::DecayPretenuringDecisions.
+inline void RecordTenureDecision(Tagged<AllocationSite> site) {
+  site->set_tenure_age(0);
+  if (!v8_flags.allocation_site_pretenuring_decay) return;
+  site->set_tenure_history(std::min(site->tenure_history() + 1,
+                                    AllocationSite::TenureHistoryBits::kMax));
+}
+
 inline bool MakePretenureDecision(
     Tagged<AllocationSite> site,
     AllocationSite::PretenureDecision current_decision, double ratio,
     bool new_space_capacity_was_above_pretenuring_threshold,
     size_t new_space_capacity) {
   // Here we just allow state transitions from undecided or maybe tenure
-  // to don't tenure, maybe tenure, or tenure.
-  if ((current_decision == AllocationSite::kUndecided ||
-       current_decision == AllocationSite::kMaybeTenure)) {
+  // to don't tenure, maybe tenure, or tenure. With decaying decisions, don't
+  // tenure is re-evaluated as well, so that sites whose objects start to
+  // survive (e.g. in a different phase of the program) are pretenured.
+  if (current_decision == AllocationSite::kUndecided ||
+      current_decision == AllocationSite::kMaybeTenure ||
+      (v8_flags.allocation_site_pretenuring_decay &&
+       current_decision == AllocationSite::kDontTenure)) {
     if (ratio >= GetPretenuringRatioThreshold(new_space_capacity)) {
       // We just transition into tenure state when the semi-space was at
       // maximum capacity.
       if (new_space_capacity_was_above_pretenuring_threshold) {
         site->set_deopt_dependent_code(true);
         site->set_pretenure_decision(AllocationSite::kTenure);
+        RecordTenureDecision(site);
         // Currently we just need to deopt when we make a state transition to
         // tenure.
         return true;
@@ -59,6 +74,7 @@ inline bool MakePretenureDecision(
       site->set_pretenure_decision(AllocationSite::kMaybeTenure);
     } else {
       site->set_pretenure_decision(AllocationSite::kDontTenure);
+      site->set_tenure_history(0);
     }
   }
   return false;
@@ -113,6 +129,7 @@ bool PretenureAllocationSiteManually(Isolate* isolate,
       current_decision == AllocationSite::kMaybeTenure) {
     site->set_deopt_dependent_code(true);
     site->set_pretenure_decision(AllocationSite::kTenure);
+    RecordTenureDecision(site);
   } else {
     deopt = false;
   }
@@ -125,7 +142,13 @@ bool PretenureAllocationSiteManually(Isolate* isolate,
                  site->PretenureDecisionName(site->pretenure_decision()));
   }
 
-  ResetPretenuringFeedback(site);
+  if (site->pretenure_decision() == AllocationSite::kTenure) {
+    // The memento found count of tenured sites holds their tenure age, which
+    // must not restart when a site is requested to be pretenured again.
+    site->set_memento_create_count(0);
+  } else {
+    ResetPretenuringFeedback(site);
+  }
   return deopt;
 }
 
@@ -151,6 +174,12 @@ void PretenuringHandler::MergeAllocationSitePretenuringFeedback(
     // dereferenced the site during collecting information.
     // This is an inlined check of AllocationMemento::IsValid.
     if (!IsAllocationSite(site) || site->IsZombie()) continue;
+    // Tenured decisions only change when they decay. The memento found count
+    // of tenured sites holds the age of the decision in that case.
+    if (v8_flags.allocation_site_pretenuring_decay &&
+        site->pretenure_decision() == AllocationSite::kTenure) {
+      continue;
+    }
 
     const int value = static_cast<int>(site_and_count.second);
     DCHECK_LT(0, value);
@@ -277,6 +306,43 @@ void PretenuringHandler::ProcessPretenuringFeedback(
   global_pretenuring_feedback_.reserve(kInitialFeedbackCapacity);
 }
 
+void PretenuringHandler::DecayPretenuringDecisions() {
+  DCHECK(v8_flags.allocation_site_pretenuring_decay);
+  DisallowGarbageCollection no_gc;
+  const int64_t decay_interval = std::max(
+      1, v8_flags.allocation_site_pretenuring_decay_interval.value());
+  int decayed_sites = 0;
+  heap_->ForeachAllocationSite(
+      heap_->allocation_sites_list(),
+      [this, decay_interval, &decayed_sites](Tagged<AllocationSite> site) {
+        if (site->pretenure_decision() != AllocationSite::kTenure) return;
+        // Decisions decay relative to when they were made, so that sites
+        // that were tenured at different times don't all deoptimize their
+        // code on the same GC.
+        const int history = std::max(1, site->tenure_history());
+        const int decay_age = static_cast<int>(
+            std::min<int64_t>(decay_interval << (history - 1),
+                              AllocationSite::MementoFoundCountBits::kMax));
+        const int age = site->tenure_age() + 1;
+        if (age < decay_age) {
+          site->set_tenure_age(age);
+          return;
+        }
+        // Keeps the tenure history, so that the site is decayed less often
+        // if it is tenured again.
+        site->ResetPretenureDecision();
+        site->set_deopt_dependent_code(true);
+        RemoveAllocationSitePretenuringFeedback(site);
+        decayed_sites++;
+      });
+  if (decayed_sites == 0) return;
+  heap_->isolate()->stack_guard()->RequestDeoptMarkedAllocationSites();
+  if (v8_flags.trace_pretenuring) {
+    PrintIsolate(heap_->isolate(),
+                 "pretenuring: decayed %d tenure decisions\n", decayed_sites);
+  }
+}
+
 void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
     Tagged<AllocationSite> site) {
   if (!allocation_sites_to_pretenure_) {
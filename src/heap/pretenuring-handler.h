@@ -68,6 +68,12 @@ class PretenuringHandler final {
   // object in old space must not move.
   void ProcessPretenuringFeedback(size_t new_space_capacity_before_gc);
 
+  // Ages the decisions of tenured allocation sites by one full GC, and resets
+  // those that are older than a number of full GCs that grows with how often
+  // the site was tenured again, so that phase changes in the program are
+  // picked up. Used with --allocation-site-pretenuring-decay.
+  void DecayPretenuringDecisions();
+
   // Removes an entry from the global pretenuring storage.
   void RemoveAllocationSitePretenuringFeedback(Tagged<AllocationSite> site);
 
@@ -217,6 +217,23 @@ class RememberedSet : public AllStatic {
     return slots;
   }
 
+  // Same as above but only iterates the buckets in [start_bucket,
+  // end_bucket). Callers are responsible for pushing the chunk to the empty
+  // chunks list once all ranges of the chunk have been processed.
+  template <typename Callback>
+  static int IterateAndTrackEmptyBuckets(MemoryChunk* chunk,
+                                         size_t start_bucket,
+                                         size_t end_bucket,
+                                         Callback callback) {
+    DCHECK_LE(start_bucket, end_bucket);
+    DCHECK_LE(end_bucket, chunk->buckets());
+    SlotSet* slot_set = chunk->slot_set<type>();
+    if (slot_set == nullptr) return 0;
+    return static_cast<int>(slot_set->IterateAndTrackEmptyBuckets(
+        chunk->address(), start_bucket, end_bucket, callback,
+        chunk->possibly_empty_buckets()));
+  }
+
   static bool CheckPossiblyEmptyBuckets(MemoryChunk* chunk) {
     DCHECK(type == OLD_TO_NEW || type == OLD_TO_NEW_BACKGROUND);
     SlotSet* slot_set = chunk->slot_set<type, AccessMode::NON_ATOMIC>();
@@ -54,6 +54,17 @@ void Scavenger::PromotionList::Local::Publish() {
   large_object_promotion_list_local_.Publish();
 }
 
+void Scavenger::PromotionList::Local::ShareWork() {
+  if (!regular_object_promotion_list_local_.IsLocalEmpty() &&
+      regular_object_promotion_list_local_.IsGlobalEmpty()) {
+    regular_object_promotion_list_local_.Publish();
+  }
+  if (!large_object_promotion_list_local_.IsLocalEmpty() &&
+      large_object_promotion_list_local_.IsGlobalEmpty()) {
+    large_object_promotion_list_local_.Publish();
+  }
+}
+
 bool Scavenger::PromotionList::Local::IsGlobalPoolEmpty() const {
   return regular_object_promotion_list_local_.IsGlobalEmpty() &&
          large_object_promotion_list_local_.IsGlobalEmpty();
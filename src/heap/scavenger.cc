@@ -184,12 +184,13 @@ bool IsUnscavengedHeapObjectSlot(Heap* heap, FullObjectSlot p) {
 ScavengerCollector::JobTask::JobTask(
     ScavengerCollector* outer,
     std::vector<std::unique_ptr<Scavenger>>* scavengers,
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
+    std::vector<MemoryChunk*> memory_chunks,
     Scavenger::CopiedList* copied_list,
     Scavenger::PromotionList* promotion_list)
     : outer_(outer),
       scavengers_(scavengers),
-      memory_chunks_(std::move(memory_chunks)),
+      memory_chunks_(
+          CreateWorkItems(std::move(memory_chunks), &remaining_ranges_)),
       remaining_memory_chunks_(memory_chunks_.size()),
       generator_(memory_chunks_.size()),
       copied_list_(copied_list),
@@ -198,6 +199,42 @@ ScavengerCollector::JobTask::JobTask(
           reinterpret_cast<uint64_t>(this) ^
           outer_->heap_->tracer()->CurrentEpoch(GCTracer::Scope::SCAVENGER)) {}
 
+// static
+std::vector<std::pair<ParallelWorkItem,
+                      ScavengerCollector::RememberedSetWorkItem>>
+ScavengerCollector::JobTask::CreateWorkItems(
+    std::vector<MemoryChunk*> memory_chunks,
+    std::vector<std::unique_ptr<std::atomic<size_t>>>* remaining_ranges) {
+  std::vector<std::pair<ParallelWorkItem, RememberedSetWorkItem>> work_items;
+  work_items.reserve(memory_chunks.size());
+  for (MemoryChunk* chunk : memory_chunks) {
+    const size_t buckets = chunk->buckets();
+    if (buckets <= kBucketsPerWorkItem ||
+        chunk->slot_set<OLD_TO_NEW>() == nullptr) {
+      work_items.emplace_back(
+          ParallelWorkItem{},
+          RememberedSetWorkItem{chunk, 0, buckets, nullptr});
+      continue;
+    }
+    // Allocate the bitmap upfront, so that ranges can record possibly empty
+    // buckets concurrently.
+    chunk->possibly_empty_buckets()->EnsureAllocated(buckets);
+    const size_t ranges =
+        (buckets + kBucketsPerWorkItem - 1) / kBucketsPerWorkItem;
+    remaining_ranges->push_back(std::make_unique<std::atomic<size_t>>(ranges));
+    std::atomic<size_t>* chunk_remaining_ranges =
+        remaining_ranges->back().get();
+    for (size_t start = 0; start < buckets; start += kBucketsPerWorkItem) {
+      work_items.emplace_back(
+          ParallelWorkItem{},
+          RememberedSetWorkItem{chunk, start,
+                                std::min(start + kBucketsPerWorkItem, buckets),
+                                chunk_remaining_ranges});
+    }
+  }
+  return work_items;
+}
+
 void ScavengerCollector::JobTask::Run(JobDelegate* delegate) {
   DCHECK_LT(delegate->GetTaskId(), scavengers_->size());
   // In case multi-cage pointer compression mode is enabled ensure that
@@ -256,7 +293,16 @@ void ScavengerCollector::JobTask::ConcurrentScavengePages(
     for (size_t i = *index; i < memory_chunks_.size(); ++i) {
       auto& work_item = memory_chunks_[i];
       if (!work_item.first.TryAcquire()) break;
-      scavenger->ScavengePage(work_item.second);
+      const RememberedSetWorkItem& item = work_item.second;
+      if (item.remaining_ranges == nullptr) {
+        scavenger->ScavengePage(item.chunk);
+      } else {
+        scavenger->ScavengePageRange(item.chunk, item.start_bucket,
+                                     item.end_bucket, item.remaining_ranges);
+      }
+      // Make objects copied from the remembered set available to idle tasks
+      // early, instead of only once the local segments are full.
+      scavenger->ShareWork();
       if (remaining_memory_chunks_.fetch_sub(1, std::memory_order_relaxed) <=
           1) {
         return;
@@ -344,13 +390,13 @@ void ScavengerCollector::CollectGarbage() {
                         &promotion_list, &ephemeron_table_list, i));
     }
 
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks;
+    std::vector<MemoryChunk*> memory_chunks;
     OldGenerationMemoryChunkIterator::ForAll(
         heap_, [&memory_chunks](MemoryChunk* chunk) {
           if (chunk->slot_set<OLD_TO_NEW>() ||
               chunk->typed_slot_set<OLD_TO_NEW>() ||
               chunk->slot_set<OLD_TO_NEW_BACKGROUND>()) {
-            memory_chunks.emplace_back(ParallelWorkItem{}, chunk);
+            memory_chunks.push_back(chunk);
           }
         });
 
@@ -680,6 +726,17 @@ void Scavenger::RememberPromotedEphemeron(Tagged<EphemeronHashTable> table,
   indices.first->second.insert(index);
 }
 
+SlotCallbackResult Scavenger::ScavengeOldToNewSlot(
+    MemoryChunk* page, MaybeObjectSlot slot, bool record_old_to_shared_slots) {
+  SlotCallbackResult result = CheckAndScavengeObject(heap_, slot);
+  // A new space string might have been promoted into the shared heap during
+  // GC.
+  if (result == REMOVE_SLOT && record_old_to_shared_slots) {
+    CheckOldToNewSlotForSharedUntyped(page, slot);
+  }
+  return result;
+}
+
 void Scavenger::ScavengePage(MemoryChunk* page) {
   CodePageMemoryModificationScope memory_modification_scope(page);
   const bool record_old_to_shared_slots = heap_->isolate()->has_shared_space();
@@ -688,17 +745,40 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
     RememberedSet<OLD_TO_NEW>::IterateAndTrackEmptyBuckets(
         page,
         [this, page, record_old_to_shared_slots](MaybeObjectSlot slot) {
-          SlotCallbackResult result = CheckAndScavengeObject(heap_, slot);
-          // A new space string might have been promoted into the shared heap
-          // during GC.
-          if (result == REMOVE_SLOT && record_old_to_shared_slots) {
-            CheckOldToNewSlotForSharedUntyped(page, slot);
-          }
-          return result;
+          return ScavengeOldToNewSlot(page, slot, record_old_to_shared_slots);
         },
         &empty_chunks_local_);
   }
 
+  ScavengeTypedAndBackgroundSlots(page);
+}
+
+void Scavenger::ScavengePageRange(MemoryChunk* page, size_t start_bucket,
+                                  size_t end_bucket,
+                                  std::atomic<size_t>* remaining_ranges) {
+  CodePageMemoryModificationScope memory_modification_scope(page);
+  const bool record_old_to_shared_slots = heap_->isolate()->has_shared_space();
+
+  RememberedSet<OLD_TO_NEW>::IterateAndTrackEmptyBuckets(
+      page, start_bucket, end_bucket,
+      [this, page, record_old_to_shared_slots](MaybeObjectSlot slot) {
+        return ScavengeOldToNewSlot(page, slot, record_old_to_shared_slots);
+      });
+
+  if (remaining_ranges->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // All ranges are done. The OLD_TO_NEW_BACKGROUND slot set shares the
+    // possibly empty buckets bitmap with the ranges, so it may only be
+    // processed now that no other task writes to it anymore.
+    ScavengeTypedAndBackgroundSlots(page);
+    if (!page->possibly_empty_buckets()->IsEmpty()) {
+      empty_chunks_local_.Push(page);
+    }
+  }
+}
+
+void Scavenger::ScavengeTypedAndBackgroundSlots(MemoryChunk* page) {
+  const bool record_old_to_shared_slots = heap_->isolate()->has_shared_space();
+
   RememberedSet<OLD_TO_NEW>::IterateTyped(
       page, [this, page, record_old_to_shared_slots](SlotType slot_type,
                                                      Address slot_address) {
@@ -721,13 +801,7 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
     RememberedSet<OLD_TO_NEW_BACKGROUND>::IterateAndTrackEmptyBuckets(
         page,
         [this, page, record_old_to_shared_slots](MaybeObjectSlot slot) {
-          SlotCallbackResult result = CheckAndScavengeObject(heap_, slot);
-          // A new space string might have been promoted into the shared heap
-          // during GC.
-          if (result == REMOVE_SLOT && record_old_to_shared_slots) {
-            CheckOldToNewSlotForSharedUntyped(page, slot);
-          }
-          return result;
+          return ScavengeOldToNewSlot(page, slot, record_old_to_shared_slots);
         },
         &empty_chunks_local_);
   }
@@ -747,6 +821,7 @@ void Scavenger::Process(JobDelegate* delegate) {
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!copied_list_local_.IsLocalEmpty()) {
+          ShareWork();
           delegate->NotifyConcurrencyIncrease();
         }
       }
@@ -758,6 +833,7 @@ void Scavenger::Process(JobDelegate* delegate) {
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        ShareWork();
         if (!promotion_list_local_.IsGlobalPoolEmpty()) {
           delegate->NotifyConcurrencyIncrease();
         }
@@ -846,6 +922,14 @@ void Scavenger::Finalize() {
   }
 }
 
+void Scavenger::ShareWork() {
+  if (!copied_list_local_.IsLocalEmpty() &&
+      copied_list_local_.IsGlobalEmpty()) {
+    copied_list_local_.Publish();
+  }
+  promotion_list_local_.ShareWork();
+}
+
 void Scavenger::Publish() {
   copied_list_local_.Publish();
   promotion_list_local_.Publish();
@@ -69,6 +69,7 @@ class Scavenger {
       inline bool IsGlobalPoolEmpty() const;
       inline bool ShouldEagerlyProcessPromotionList() const;
       inline void Publish();
+      inline void ShareWork();
 
      private:
       RegularObjectPromotionList::Local regular_object_promotion_list_local_;
@@ -99,6 +100,19 @@ class Scavenger {
   // objects see RootScavengingVisitor and ScavengeVisitor below.
   void ScavengePage(MemoryChunk* page);
 
+  // Scavenges the untyped OLD_TO_NEW slots of the buckets [start_bucket,
+  // end_bucket) of |page|. Used for splitting up large pages between tasks.
+  // The task finishing the last range of a page (as tracked by
+  // |remaining_ranges|) also scavenges its typed and OLD_TO_NEW_BACKGROUND
+  // slots and records the page for the possibly empty buckets check.
+  void ScavengePageRange(MemoryChunk* page, size_t start_bucket,
+                         size_t end_bucket,
+                         std::atomic<size_t>* remaining_ranges);
+
+  // Publishes local work if the global pools are empty, so that idle tasks
+  // can steal it.
+  void ShareWork();
+
   // Processes remaining work (=objects) after single objects have been
   // manually scavenged using ScavengeObject or CheckAndScavengeObject.
   void Process(JobDelegate* delegate = nullptr);
@@ -130,6 +144,12 @@ class Scavenger {
   template <typename TSlot>
   inline SlotCallbackResult CheckAndScavengeObject(Heap* heap, TSlot slot);
 
+  // Scavenges the object referenced from an untyped OLD_TO_NEW slot of |page|.
+  SlotCallbackResult ScavengeOldToNewSlot(MemoryChunk* page,
+                                          MaybeObjectSlot slot,
+                                          bool record_old_to_shared_slots);
+  void ScavengeTypedAndBackgroundSlots(MemoryChunk* page);
+
   template <typename TSlot>
   inline void CheckOldToNewSlotForSharedUntyped(MemoryChunk* chunk, TSlot slot);
   inline void CheckOldToNewSlotForSharedTyped(MemoryChunk* chunk,
@@ -254,14 +274,34 @@ class ScavengerCollector {
   void CollectGarbage();
 
  private:
+  // A unit of OLD_TO_NEW remembered set work. Regular pages are processed as a
+  // whole, while the slot sets of large pages are split into ranges of
+  // kBucketsPerWorkItem buckets, so that a single huge page does not bound the
+  // length of the parallel phase.
+  struct RememberedSetWorkItem {
+    MemoryChunk* chunk;
+    size_t start_bucket;
+    size_t end_bucket;
+    // Ranges of |chunk| that still need to be processed. nullptr for chunks
+    // that are processed as a whole.
+    std::atomic<size_t>* remaining_ranges;
+  };
+
   class JobTask : public v8::JobTask {
    public:
-    explicit JobTask(
-        ScavengerCollector* outer,
-        std::vector<std::unique_ptr<Scavenger>>* scavengers,
-        std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks,
-        Scavenger::CopiedList* copied_list,
-        Scavenger::PromotionList* promotion_list);
+    // Number of slot set buckets in a split work item. Must be a multiple of
+    // PossiblyEmptyBuckets::kBucketsPerWord so that concurrently processed
+    // ranges never share a word of the possibly empty buckets bitmap.
+    static constexpr size_t kBucketsPerWorkItem = 64;
+    static_assert(kBucketsPerWorkItem %
+                      PossiblyEmptyBuckets::kBucketsPerWord ==
+                  0);
+
+    explicit JobTask(ScavengerCollector* outer,
+                     std::vector<std::unique_ptr<Scavenger>>* scavengers,
+                     std::vector<MemoryChunk*> memory_chunks,
+                     Scavenger::CopiedList* copied_list,
+                     Scavenger::PromotionList* promotion_list);
 
     void Run(JobDelegate* delegate) override;
     size_t GetMaxConcurrency(size_t worker_count) const override;
@@ -269,13 +309,22 @@ class ScavengerCollector {
     uint64_t trace_id() const { return trace_id_; }
 
    private:
+    static std::vector<std::pair<ParallelWorkItem, RememberedSetWorkItem>>
+    CreateWorkItems(
+        std::vector<MemoryChunk*> memory_chunks,
+        std::vector<std::unique_ptr<std::atomic<size_t>>>* remaining_ranges);
+
     void ProcessItems(JobDelegate* delegate, Scavenger* scavenger);
     void ConcurrentScavengePages(Scavenger* scavenger);
 
     ScavengerCollector* outer_;
 
     std::vector<std::unique_ptr<Scavenger>>* scavengers_;
-    std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks_;
+    // Owns the remaining range counters of split chunks. Needs to be declared
+    // before |memory_chunks_|, which is initialized from it.
+    std::vector<std::unique_ptr<std::atomic<size_t>>> remaining_ranges_;
+    std::vector<std::pair<ParallelWorkItem, RememberedSetWorkItem>>
+        memory_chunks_;
     std::atomic<size_t> remaining_memory_chunks_{0};
     IndexGenerator generator_;
 
@@ -33,6 +33,9 @@ using ::heap::base::SlotCallbackResult;
 // is replaced with a pointer to a malloc-allocated bitmap.
 class PossiblyEmptyBuckets {
  public:
+  // Number of buckets tracked by a single word of the out-of-line bitmap.
+  static constexpr size_t kBucketsPerWord = sizeof(uintptr_t) * kBitsPerByte;
+
   PossiblyEmptyBuckets() = default;
   PossiblyEmptyBuckets(PossiblyEmptyBuckets&& other) V8_NOEXCEPT
       : bitmap_(other.bitmap_) {
@@ -63,6 +66,13 @@ class PossiblyEmptyBuckets {
     }
   }
 
+  // Switches to the out-of-line bitmap. Afterwards, inserting buckets from
+  // disjoint ranges that are aligned to kBucketsPerWord is safe to do
+  // concurrently, as those ranges never share a bitmap word.
+  void EnsureAllocated(size_t buckets) {
+    if (!IsAllocated()) Allocate(buckets);
+  }
+
   bool Contains(size_t bucket_index) {
     if (IsAllocated()) {
       size_t word_idx = bucket_index / kBitsPerWord;
@@ -82,6 +92,7 @@ class PossiblyEmptyBuckets {
   static constexpr Address kPointerTag = 1;
   static constexpr int kWordSize = sizeof(uintptr_t);
   static constexpr int kBitsPerWord = kWordSize * kBitsPerByte;
+  static_assert(kBucketsPerWord == kBitsPerWord);
 
   bool IsAllocated() { return bitmap_ & kPointerTag; }
 
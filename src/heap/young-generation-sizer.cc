@@ -0,0 +1,52 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/young-generation-sizer.h"
+
+#include <algorithm>
+
+#include "src/flags/flags.h"
+#include "src/heap/heap.h"
+#include "src/heap/spaces.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+size_t YoungGenerationSizer::MaxSemiSpaceSize(uint64_t physical_memory) {
+  // Allow 1/128th of the physical memory per semi-space, i.e. 128 MB on a
+  // 16 GB host, but at most 256 MB (512 MB without pointer compression) and
+  // never less than the default.
+  static constexpr size_t kMaxSemiSpaceSize =
+      256 * MB * Heap::kPointerMultiplier;
+  const size_t semi_space_size = static_cast<size_t>(
+      std::min<uint64_t>(physical_memory / 128, kMaxSemiSpaceSize));
+  return RoundDown<Page::kPageSize>(
+      std::max(semi_space_size, Heap::DefaultMaxSemiSpaceSize()));
+}
+
+// static
+size_t YoungGenerationSizer::TargetCapacity(
+    double allocation_throughput, double survival_ratio, double survived_speed,
+    double max_pause_ms, size_t current_capacity, size_t min_capacity,
+    size_t max_capacity) {
+  DCHECK_LE(min_capacity, max_capacity);
+  if (allocation_throughput == 0 || survived_speed == 0) {
+    return current_capacity;
+  }
+  if (allocation_throughput < kIdleAllocationThroughput) return min_capacity;
+
+  double capacity = allocation_throughput *
+                    v8_flags.adaptive_young_generation_gc_interval_ms;
+  if (survival_ratio > 0) {
+    capacity = std::min(capacity, max_pause_ms * survived_speed /
+                                      std::min(survival_ratio, 1.0));
+  }
+  if (capacity >= max_capacity) return max_capacity;
+  return std::clamp(RoundUp<Page::kPageSize>(static_cast<size_t>(capacity)),
+                    min_capacity, max_capacity);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,43 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_YOUNG_GENERATION_SIZER_H_
+#define V8_HEAP_YOUNG_GENERATION_SIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "src/common/globals.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+// Picks the new space capacity for --adaptive-young-generation. New space
+// should absorb a fixed amount of allocation time, so that the number of
+// young GCs per second stays constant, but a young GC of a full new space,
+// which costs time proportional to the surviving bytes, must fit into a pause
+// target. Workloads allocating lots of short-lived objects thus get a large
+// new space, while idle ones fall back to the minimum.
+class V8_EXPORT_PRIVATE YoungGenerationSizer : public AllStatic {
+ public:
+  // Allocation throughput below which the isolate is considered idle.
+  static constexpr double kIdleAllocationThroughput = 1000;
+
+  // The maximum semi-space size for a host with |physical_memory| bytes of
+  // memory.
+  static size_t MaxSemiSpaceSize(uint64_t physical_memory);
+
+  // Throughput and speed are in bytes/ms, |survival_ratio| is between 0 and
+  // 1. Returns |current_capacity| if there is not enough data yet.
+  static size_t TargetCapacity(double allocation_throughput,
+                               double survival_ratio, double survived_speed,
+                               double max_pause_ms, size_t current_capacity,
+                               size_t min_capacity, size_t max_capacity);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_YOUNG_GENERATION_SIZER_H_
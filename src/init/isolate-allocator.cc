@@ -7,6 +7,7 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/heap/code-range.h"
 #include "src/sandbox/sandbox.h"
 #include "src/utils/memcopy.h"
@@ -40,6 +41,7 @@ struct PtrComprCageReservationParams
 #else
     jit = JitPermission::kNoJit;
 #endif
+    huge_pages = v8_flags.huge_pages;
   }
 };
 #endif  // V8_COMPRESS_POINTERS
@@ -24,6 +24,8 @@ namespace internal {
 namespace {
 
 v8::StartupData g_snapshot;
+// The mapping of the snapshot blob file, if it wasn't read into g_snapshot.
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
@@ -36,15 +38,43 @@ void DeleteStartupData(v8::StartupData* data) {
 }
 
 void FreeStartupData() {
+  if (g_snapshot_file != nullptr) {
+    ClearStartupData(&g_snapshot);
+    delete g_snapshot_file;
+    g_snapshot_file = nullptr;
+    return;
+  }
   DeleteStartupData(&g_snapshot);
 }
 
+// Maps the blob read-only instead of copying it to the heap, so that its pages
+// are shared by all processes using the same snapshot and are only faulted in
+// when the deserializer touches them.
+bool Map(const char* blob_file, v8::StartupData* startup_data) {
+  base::OS::MemoryMappedFile* file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (file == nullptr) return false;
+  if (file->size() == 0 || file->size() > static_cast<size_t>(kMaxInt)) {
+    delete file;
+    return false;
+  }
+  startup_data->data = static_cast<const char*>(file->memory());
+  startup_data->raw_size = static_cast<int>(file->size());
+  g_snapshot_file = file;
+  return true;
+}
+
 void Load(const char* blob_file, v8::StartupData* startup_data,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
+  if (v8_flags.mmap_snapshot_blob && Map(blob_file, startup_data)) {
+    (*setter_fn)(startup_data);
+    return;
+  }
+
   FILE* file = base::Fopen(blob_file, "rb");
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
@@ -0,0 +1,133 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_PARSER_TABLES_H_
+#define V8_JSON_JSON_PARSER_TABLES_H_
+
+#include "src/base/bit-field.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// Character classification tables shared between the JsonParser and the
+// JsonStreamingParser.
+
+enum class JsonToken : uint8_t {
+  NUMBER,
+  STRING,
+  LBRACE,
+  RBRACE,
+  LBRACK,
+  RBRACK,
+  TRUE_LITERAL,
+  FALSE_LITERAL,
+  NULL_LITERAL,
+  WHITESPACE,
+  COLON,
+  COMMA,
+  ILLEGAL,
+  EOS
+};
+
+constexpr JsonToken GetOneCharJsonToken(uint8_t c) {
+  // clang-format off
+  return
+     c == '"' ? JsonToken::STRING :
+     IsDecimalDigit(c) ?  JsonToken::NUMBER :
+     c == '-' ? JsonToken::NUMBER :
+     c == '[' ? JsonToken::LBRACK :
+     c == '{' ? JsonToken::LBRACE :
+     c == ']' ? JsonToken::RBRACK :
+     c == '}' ? JsonToken::RBRACE :
+     c == 't' ? JsonToken::TRUE_LITERAL :
+     c == 'f' ? JsonToken::FALSE_LITERAL :
+     c == 'n' ? JsonToken::NULL_LITERAL :
+     c == ' ' ? JsonToken::WHITESPACE :
+     c == '\t' ? JsonToken::WHITESPACE :
+     c == '\r' ? JsonToken::WHITESPACE :
+     c == '\n' ? JsonToken::WHITESPACE :
+     c == ':' ? JsonToken::COLON :
+     c == ',' ? JsonToken::COMMA :
+     JsonToken::ILLEGAL;
+  // clang-format on
+}
+
+// Table of one-character tokens, by character (0x00..0xFF only).
+inline constexpr JsonToken one_char_json_tokens[256] = {
+#define CALL_GET_SCAN_FLAGS(N) GetOneCharJsonToken(N),
+    INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
+#undef CALL_GET_SCAN_FLAGS
+#define CALL_GET_SCAN_FLAGS(N) GetOneCharJsonToken(128 + N),
+        INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
+#undef CALL_GET_SCAN_FLAGS
+};
+
+enum class EscapeKind : uint8_t {
+  kIllegal,
+  kSelf,
+  kBackspace,
+  kTab,
+  kNewLine,
+  kFormFeed,
+  kCarriageReturn,
+  kUnicode
+};
+
+using EscapeKindField = base::BitField8<EscapeKind, 0, 3>;
+using MayTerminateStringField = EscapeKindField::Next<bool, 1>;
+using NumberPartField = MayTerminateStringField::Next<bool, 1>;
+
+constexpr bool MayTerminateJsonString(uint8_t flags) {
+  return MayTerminateStringField::decode(flags);
+}
+
+constexpr EscapeKind GetEscapeKind(uint8_t flags) {
+  return EscapeKindField::decode(flags);
+}
+
+constexpr bool IsNumberPart(uint8_t flags) {
+  return NumberPartField::decode(flags);
+}
+
+constexpr uint8_t GetJsonScanFlags(uint8_t c) {
+  // clang-format off
+  return (c == 'b' ? EscapeKindField::encode(EscapeKind::kBackspace)
+          : c == 't' ? EscapeKindField::encode(EscapeKind::kTab)
+          : c == 'n' ? EscapeKindField::encode(EscapeKind::kNewLine)
+          : c == 'f' ? EscapeKindField::encode(EscapeKind::kFormFeed)
+          : c == 'r' ? EscapeKindField::encode(EscapeKind::kCarriageReturn)
+          : c == 'u' ? EscapeKindField::encode(EscapeKind::kUnicode)
+          : c == '"' ? EscapeKindField::encode(EscapeKind::kSelf)
+          : c == '\\' ? EscapeKindField::encode(EscapeKind::kSelf)
+          : c == '/' ? EscapeKindField::encode(EscapeKind::kSelf)
+          : EscapeKindField::encode(EscapeKind::kIllegal)) |
+         (c < 0x20 ? MayTerminateStringField::encode(true)
+          : c == '"' ? MayTerminateStringField::encode(true)
+          : c == '\\' ? MayTerminateStringField::encode(true)
+          : MayTerminateStringField::encode(false)) |
+         NumberPartField::encode(c == '.' ||
+                                 c == 'e' ||
+                                 c == 'E' ||
+                                 IsDecimalDigit(c) ||
+                                 c == '-' ||
+                                 c == '+');
+  // clang-format on
+}
+
+// Table of one-character scan flags, by character (0x00..0xFF only).
+inline constexpr uint8_t character_json_scan_flags[256] = {
+#define CALL_GET_SCAN_FLAGS(N) GetJsonScanFlags(N),
+    INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
+#undef CALL_GET_SCAN_FLAGS
+#define CALL_GET_SCAN_FLAGS(N) GetJsonScanFlags(128 + N),
+        INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
+#undef CALL_GET_SCAN_FLAGS
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_PARSER_TABLES_H_
@@ -11,6 +11,8 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/json/json-parser-tables.h"
+#include "src/json/json-string-scanner.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/field-type.h"
@@ -25,105 +27,6 @@
 namespace v8 {
 namespace internal {
 
-namespace {
-
-constexpr JsonToken GetOneCharJsonToken(uint8_t c) {
-  // clang-format off
-  return
-     c == '"' ? JsonToken::STRING :
-     IsDecimalDigit(c) ?  JsonToken::NUMBER :
-     c == '-' ? JsonToken::NUMBER :
-     c == '[' ? JsonToken::LBRACK :
-     c == '{' ? JsonToken::LBRACE :
-     c == ']' ? JsonToken::RBRACK :
-     c == '}' ? JsonToken::RBRACE :
-     c == 't' ? JsonToken::TRUE_LITERAL :
-     c == 'f' ? JsonToken::FALSE_LITERAL :
-     c == 'n' ? JsonToken::NULL_LITERAL :
-     c == ' ' ? JsonToken::WHITESPACE :
-     c == '\t' ? JsonToken::WHITESPACE :
-     c == '\r' ? JsonToken::WHITESPACE :
-     c == '\n' ? JsonToken::WHITESPACE :
-     c == ':' ? JsonToken::COLON :
-     c == ',' ? JsonToken::COMMA :
-     JsonToken::ILLEGAL;
-  // clang-format on
-}
-
-// Table of one-character tokens, by character (0x00..0xFF only).
-static const constexpr JsonToken one_char_json_tokens[256] = {
-#define CALL_GET_SCAN_FLAGS(N) GetOneCharJsonToken(N),
-    INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
-#undef CALL_GET_SCAN_FLAGS
-#define CALL_GET_SCAN_FLAGS(N) GetOneCharJsonToken(128 + N),
-        INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
-#undef CALL_GET_SCAN_FLAGS
-};
-
-enum class EscapeKind : uint8_t {
-  kIllegal,
-  kSelf,
-  kBackspace,
-  kTab,
-  kNewLine,
-  kFormFeed,
-  kCarriageReturn,
-  kUnicode
-};
-
-using EscapeKindField = base::BitField8<EscapeKind, 0, 3>;
-using MayTerminateStringField = EscapeKindField::Next<bool, 1>;
-using NumberPartField = MayTerminateStringField::Next<bool, 1>;
-
-constexpr bool MayTerminateJsonString(uint8_t flags) {
-  return MayTerminateStringField::decode(flags);
-}
-
-constexpr EscapeKind GetEscapeKind(uint8_t flags) {
-  return EscapeKindField::decode(flags);
-}
-
-constexpr bool IsNumberPart(uint8_t flags) {
-  return NumberPartField::decode(flags);
-}
-
-constexpr uint8_t GetJsonScanFlags(uint8_t c) {
-  // clang-format off
-  return (c == 'b' ? EscapeKindField::encode(EscapeKind::kBackspace)
-          : c == 't' ? EscapeKindField::encode(EscapeKind::kTab)
-          : c == 'n' ? EscapeKindField::encode(EscapeKind::kNewLine)
-          : c == 'f' ? EscapeKindField::encode(EscapeKind::kFormFeed)
-          : c == 'r' ? EscapeKindField::encode(EscapeKind::kCarriageReturn)
-          : c == 'u' ? EscapeKindField::encode(EscapeKind::kUnicode)
-          : c == '"' ? EscapeKindField::encode(EscapeKind::kSelf)
-          : c == '\\' ? EscapeKindField::encode(EscapeKind::kSelf)
-          : c == '/' ? EscapeKindField::encode(EscapeKind::kSelf)
-          : EscapeKindField::encode(EscapeKind::kIllegal)) |
-         (c < 0x20 ? MayTerminateStringField::encode(true)
-          : c == '"' ? MayTerminateStringField::encode(true)
-          : c == '\\' ? MayTerminateStringField::encode(true)
-          : MayTerminateStringField::encode(false)) |
-         NumberPartField::encode(c == '.' ||
-                                 c == 'e' ||
-                                 c == 'E' ||
-                                 IsDecimalDigit(c) ||
-                                 c == '-' ||
-                                 c == '+');
-  // clang-format on
-}
-
-// Table of one-character scan flags, by character (0x00..0xFF only).
-static const constexpr uint8_t character_json_scan_flags[256] = {
-#define CALL_GET_SCAN_FLAGS(N) GetJsonScanFlags(N),
-    INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
-#undef CALL_GET_SCAN_FLAGS
-#define CALL_GET_SCAN_FLAGS(N) GetJsonScanFlags(128 + N),
-        INT_0_TO_127_LIST(CALL_GET_SCAN_FLAGS)
-#undef CALL_GET_SCAN_FLAGS
-};
-
-}  // namespace
-
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
     Isolate* isolate, Handle<Object> result, Handle<Object> reviver,
     Handle<String> source, MaybeHandle<Object> val_node) {
@@ -1577,13 +1480,13 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = FindJsonStringTerminator(cursor_, end_);
+    } else {
+      uint16_t chars_bits = 0;
+      cursor_ = FindJsonStringTerminator(cursor_, end_, &chars_bits);
+      bits |= chars_bits;
+    }
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowGarbageCollection allow_before_exception;
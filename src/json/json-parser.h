@@ -11,6 +11,7 @@
 #include "src/common/high-allocation-throughput-scope.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/json/json-parser-tables.h"
 #include "src/objects/objects.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -132,23 +133,6 @@ class JsonParseInternalizer {
   Handle<String> source_;
 };
 
-enum class JsonToken : uint8_t {
-  NUMBER,
-  STRING,
-  LBRACE,
-  RBRACE,
-  LBRACK,
-  RBRACK,
-  TRUE_LITERAL,
-  FALSE_LITERAL,
-  NULL_LITERAL,
-  WHITESPACE,
-  COLON,
-  COMMA,
-  ILLEGAL,
-  EOS
-};
-
 // A simple json parser.
 template <typename Char>
 class JsonParser final {
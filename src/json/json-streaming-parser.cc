@@ -0,0 +1,562 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/base/strings.h"
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/numbers/conversions.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/js-array.h"
+#include "src/objects/objects-inl.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr int kInitialStackFrames = 4;
+
+}  // namespace
+
+JsonStreamingParser::JsonStreamingParser(Isolate* isolate)
+    : isolate_(isolate) {
+  stack_ = isolate->global_handles()->Create(*factory()->NewFixedArray(
+      kFirstFrameIndex + kInitialStackFrames * kFrameSize));
+}
+
+JsonStreamingParser::~JsonStreamingParser() {
+  GlobalHandles::Destroy(stack_.location());
+}
+
+Factory* JsonStreamingParser::factory() const { return isolate_->factory(); }
+
+Maybe<bool> JsonStreamingParser::Write(base::Vector<const uint8_t> chunk) {
+  if (state_ == State::kError) {
+    isolate_->Throw(stack()->get(kResultIndex));
+    return Nothing<bool>();
+  }
+
+  const uint8_t* cursor = chunk.begin();
+  const uint8_t* end = chunk.end();
+  chunk_start_ = cursor;
+  while (cursor != end) {
+    // Values are stored into their containers as soon as they are complete,
+    // so no handles need to survive a single step.
+    HandleScope scope(isolate_);
+    switch (state_) {
+      case State::kString:
+        cursor = ScanString(cursor, end);
+        break;
+      case State::kNumber:
+        cursor = ScanNumber(cursor, end);
+        break;
+      case State::kStringEscape:
+      case State::kStringUnicodeEscape:
+      case State::kLiteral:
+        Step(cursor++);
+        break;
+      default:
+        cursor = ScanWhitespace(cursor, end);
+        if (cursor != end) Step(cursor++);
+        break;
+    }
+    if (V8_UNLIKELY(state_ == State::kError)) return Nothing<bool>();
+  }
+  chunk_position_ += chunk.size();
+  chunk_start_ = nullptr;
+  return Just(true);
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish() {
+  if (state_ == State::kError) {
+    isolate_->Throw(stack()->get(kResultIndex));
+    return kNullMaybeHandle;
+  }
+  if (state_ == State::kNumber) EndNumber();
+  if (state_ == State::kError) return kNullMaybeHandle;
+  if (state_ != State::kDone) {
+    isolate_->Throw(
+        *factory()->NewSyntaxError(MessageTemplate::kJsonParseUnexpectedEOS));
+    ReportPendingException();
+    return kNullMaybeHandle;
+  }
+  return handle(stack()->get(kResultIndex), isolate_);
+}
+
+const uint8_t* JsonStreamingParser::ScanWhitespace(const uint8_t* cursor,
+                                                   const uint8_t* end) {
+  for (; cursor != end; ++cursor) {
+    uint8_t c = *cursor;
+    if (one_char_json_tokens[c] != JsonToken::WHITESPACE) {
+      last_was_carriage_return_ = false;
+      break;
+    }
+    // \r\n counts as a single line terminator, like in the JsonParser.
+    if (c == '\r' || (c == '\n' && !last_was_carriage_return_)) ++line_;
+    if (c == '\r' || c == '\n') line_start_ = PositionOf(cursor) + 1;
+    last_was_carriage_return_ = c == '\r';
+  }
+  return cursor;
+}
+
+void JsonStreamingParser::Step(const uint8_t* cursor) {
+  uint8_t c = *cursor;
+  switch (state_) {
+    case State::kValueOrEndArray:
+      if (c == ']') return CloseContainer();
+      V8_FALLTHROUGH;
+    case State::kValue:
+      return BeginValue(cursor);
+
+    case State::kKeyOrEndObject:
+      if (c == '}') return CloseContainer();
+      if (c == '"') return BeginString(true);
+      return ReportError(MessageTemplate::kJsonParseExpectedPropNameOrRBrace,
+                         cursor);
+
+    case State::kKey:
+      if (c == '"') return BeginString(true);
+      return ReportError(
+          MessageTemplate::kJsonParseExpectedDoubleQuotedPropertyName, cursor);
+
+    case State::kColon:
+      if (c == ':') {
+        state_ = State::kValue;
+        return;
+      }
+      return ReportError(
+          MessageTemplate::kJsonParseExpectedColonAfterPropertyName, cursor);
+
+    case State::kCommaOrEnd:
+      if (containers_.back() == ContainerKind::kArray) {
+        if (c == ',') {
+          state_ = State::kValue;
+          return;
+        }
+        if (c == ']') return CloseContainer();
+        return ReportError(MessageTemplate::kJsonParseExpectedCommaOrRBrack,
+                           cursor);
+      }
+      if (c == ',') {
+        state_ = State::kKey;
+        return;
+      }
+      if (c == '}') return CloseContainer();
+      return ReportError(MessageTemplate::kJsonParseExpectedCommaOrRBrace,
+                         cursor);
+
+    case State::kDone:
+      return ReportError(
+          MessageTemplate::kJsonParseUnexpectedNonWhiteSpaceCharacter, cursor);
+
+    case State::kStringEscape:
+      switch (GetEscapeKind(character_json_scan_flags[c])) {
+        case EscapeKind::kSelf:
+          AppendCharacter(c);
+          break;
+        case EscapeKind::kBackspace:
+          AppendCharacter('\x08');
+          break;
+        case EscapeKind::kTab:
+          AppendCharacter('\x09');
+          break;
+        case EscapeKind::kNewLine:
+          AppendCharacter('\x0A');
+          break;
+        case EscapeKind::kFormFeed:
+          AppendCharacter('\x0C');
+          break;
+        case EscapeKind::kCarriageReturn:
+          AppendCharacter('\x0D');
+          break;
+        case EscapeKind::kUnicode:
+          unicode_escape_digits_ = 0;
+          unicode_escape_value_ = 0;
+          state_ = State::kStringUnicodeEscape;
+          return;
+        case EscapeKind::kIllegal:
+          return ReportError(MessageTemplate::kJsonParseBadEscapedCharacter,
+                             cursor);
+      }
+      state_ = State::kString;
+      return;
+
+    case State::kStringUnicodeEscape: {
+      int digit = base::HexValue(c);
+      if (V8_UNLIKELY(digit < 0)) {
+        return ReportError(MessageTemplate::kJsonParseBadUnicodeEscape,
+                           cursor);
+      }
+      unicode_escape_value_ = unicode_escape_value_ * 16 + digit;
+      // Surrogate pairs are written as two escapes, which end up next to each
+      // other in the UTF-16 buffer.
+      if (++unicode_escape_digits_ == 4) {
+        AppendCharacter(unicode_escape_value_);
+        state_ = State::kString;
+      }
+      return;
+    }
+
+    case State::kLiteral:
+      if (V8_UNLIKELY(c != literal_[literal_index_])) {
+        return ReportError(MessageTemplate::kJsonParseUnexpectedCharacter,
+                           cursor);
+      }
+      if (literal_[++literal_index_] == '\0') EndLiteral();
+      return;
+
+    case State::kString:
+    case State::kNumber:
+    case State::kError:
+      UNREACHABLE();
+  }
+}
+
+void JsonStreamingParser::BeginValue(const uint8_t* cursor) {
+  uint8_t c = *cursor;
+  switch (one_char_json_tokens[c]) {
+    case JsonToken::STRING:
+      return BeginString(false);
+    case JsonToken::NUMBER:
+      number_start_ = PositionOf(cursor);
+      number_buffer_.clear();
+      number_buffer_.push_back(c);
+      state_ = State::kNumber;
+      return;
+    case JsonToken::LBRACE:
+      return OpenContainer(ContainerKind::kObject);
+    case JsonToken::LBRACK:
+      return OpenContainer(ContainerKind::kArray);
+    case JsonToken::TRUE_LITERAL:
+      literal_ = "true";
+      break;
+    case JsonToken::FALSE_LITERAL:
+      literal_ = "false";
+      break;
+    case JsonToken::NULL_LITERAL:
+      literal_ = "null";
+      break;
+    default:
+      return ReportError(MessageTemplate::kJsonParseUnexpectedCharacter,
+                         cursor);
+  }
+  literal_index_ = 1;
+  state_ = State::kLiteral;
+}
+
+void JsonStreamingParser::BeginString(bool is_key) {
+  string_is_key_ = is_key;
+  utf8_state_ = Utf8DfaDecoder::kAccept;
+  utf8_buffer_ = 0;
+  one_byte_buffer_.clear();
+  two_byte_buffer_.clear();
+  state_ = State::kString;
+}
+
+const uint8_t* JsonStreamingParser::ScanString(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  while (cursor != end) {
+    uint8_t c = *cursor;
+    if (utf8_state_ != Utf8DfaDecoder::kAccept ||
+        c > unibrow::Utf8::kMaxOneByteChar) {
+      // Multi-byte sequences may be split across chunks; the decoder state
+      // carries over.
+      Utf8DfaDecoder::State previous = utf8_state_;
+      Utf8DfaDecoder::Decode(c, &utf8_state_, &utf8_buffer_);
+      if (utf8_state_ == Utf8DfaDecoder::kAccept) {
+        AppendCodePoint(utf8_buffer_);
+        utf8_buffer_ = 0;
+      } else if (utf8_state_ == Utf8DfaDecoder::kReject) {
+        utf8_state_ = Utf8DfaDecoder::kAccept;
+        utf8_buffer_ = 0;
+        AppendCharacter(unibrow::Utf8::kBadChar);
+        // A byte that ends an incomplete sequence might start the next one.
+        if (previous != Utf8DfaDecoder::kAccept) continue;
+      }
+      ++cursor;
+      continue;
+    }
+
+    if (V8_LIKELY(!MayTerminateJsonString(character_json_scan_flags[c]))) {
+      const uint8_t* start = cursor;
+      cursor = std::find_if(cursor + 1, end, [](uint8_t next) {
+        return next > unibrow::Utf8::kMaxOneByteChar ||
+               MayTerminateJsonString(character_json_scan_flags[next]);
+      });
+      if (V8_LIKELY(two_byte_buffer_.empty())) {
+        one_byte_buffer_.insert(one_byte_buffer_.end(), start, cursor);
+      } else {
+        two_byte_buffer_.insert(two_byte_buffer_.end(), start, cursor);
+      }
+      continue;
+    }
+
+    if (c == '"') {
+      EndString();
+      return cursor + 1;
+    }
+    if (c == '\\') {
+      state_ = State::kStringEscape;
+      return cursor + 1;
+    }
+    DCHECK_LT(c, 0x20);
+    ReportError(MessageTemplate::kJsonParseBadControlCharacter, cursor);
+    return cursor;
+  }
+  return cursor;
+}
+
+void JsonStreamingParser::AppendCharacter(base::uc16 c) {
+  if (V8_LIKELY(two_byte_buffer_.empty())) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      one_byte_buffer_.push_back(static_cast<uint8_t>(c));
+      return;
+    }
+    two_byte_buffer_.assign(one_byte_buffer_.begin(), one_byte_buffer_.end());
+    one_byte_buffer_.clear();
+  }
+  two_byte_buffer_.push_back(c);
+}
+
+void JsonStreamingParser::AppendCodePoint(uint32_t code_point) {
+  if (code_point > unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    AppendCharacter(unibrow::Utf16::LeadSurrogate(code_point));
+    AppendCharacter(unibrow::Utf16::TrailSurrogate(code_point));
+    return;
+  }
+  AppendCharacter(static_cast<base::uc16>(code_point));
+}
+
+MaybeHandle<String> JsonStreamingParser::MakeString() {
+  // Property keys and short values go through the string table, like in the
+  // JsonParser, so that repeated keys share a single internalized string.
+  if (two_byte_buffer_.empty()) {
+    base::Vector<const uint8_t> chars(one_byte_buffer_.data(),
+                                      one_byte_buffer_.size());
+    if (chars.empty()) return factory()->empty_string();
+    if (string_is_key_ || chars.length() <= kMaxInternalizedStringValueLength) {
+      return factory()->InternalizeString(chars);
+    }
+    return factory()->NewStringFromOneByte(chars);
+  }
+  base::Vector<const base::uc16> chars(two_byte_buffer_.data(),
+                                       two_byte_buffer_.size());
+  if (string_is_key_ || chars.length() <= kMaxInternalizedStringValueLength) {
+    return factory()->InternalizeString(chars);
+  }
+  return factory()->NewStringFromTwoByte(chars);
+}
+
+void JsonStreamingParser::EndString() {
+  Handle<String> string;
+  if (!MakeString().ToHandle(&string)) return ReportPendingException();
+  if (string_is_key_) {
+    stack()->set(FrameIndex() + 1, *string);
+    state_ = State::kColon;
+    return;
+  }
+  AddValue(string);
+}
+
+const uint8_t* JsonStreamingParser::ScanNumber(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  // Collect everything that may be part of a number and validate it once the
+  // number is complete, which only happens on the first non-number byte.
+  const uint8_t* start = cursor;
+  cursor = std::find_if(cursor, end, [](uint8_t next) {
+    return !IsNumberPart(character_json_scan_flags[next]);
+  });
+  number_buffer_.insert(number_buffer_.end(), start, cursor);
+  if (cursor != end) EndNumber();
+  return cursor;
+}
+
+void JsonStreamingParser::EndNumber() {
+  base::Vector<const uint8_t> chars(number_buffer_.data(),
+                                    number_buffer_.size());
+  auto IsDigitAt = [&](size_t index) {
+    return index < chars.size() && IsDecimalDigit(chars[index]);
+  };
+
+  size_t i = 0;
+  bool negative = chars[0] == '-';
+  if (negative) i++;
+  if (!IsDigitAt(i)) {
+    return ReportError(MessageTemplate::kJsonParseNoNumberAfterMinusSign,
+                       number_start_ + i);
+  }
+  if (chars[i] == '0') {
+    // Prefix zero is only allowed if it's the only digit before a decimal
+    // point or exponent.
+    if (IsDigitAt(++i)) {
+      return ReportError(MessageTemplate::kJsonParseUnexpectedTokenNumber,
+                         number_start_ + i);
+    }
+  } else {
+    while (IsDigitAt(i)) i++;
+  }
+  bool is_integer = true;
+  if (i < chars.size() && chars[i] == '.') {
+    is_integer = false;
+    if (!IsDigitAt(++i)) {
+      return ReportError(
+          MessageTemplate::kJsonParseUnterminatedFractionalNumber,
+          number_start_ + i);
+    }
+    while (IsDigitAt(i)) i++;
+  }
+  if (i < chars.size() && AsciiAlphaToLower(chars[i]) == 'e') {
+    is_integer = false;
+    i++;
+    if (i < chars.size() && (chars[i] == '-' || chars[i] == '+')) i++;
+    if (!IsDigitAt(i)) {
+      return ReportError(MessageTemplate::kJsonParseExponentPartMissingNumber,
+                         number_start_ + i);
+    }
+    while (IsDigitAt(i)) i++;
+  }
+  if (i != chars.size()) {
+    return ReportError(MessageTemplate::kJsonParseUnexpectedCharacter,
+                       number_start_ + i);
+  }
+
+  static_assert(Smi::IsValid(-999999999));
+  static_assert(Smi::IsValid(999999999));
+  const size_t kMaxSmiLength = 9;
+  if (is_integer && chars.size() - negative <= kMaxSmiLength) {
+    int32_t value = 0;
+    for (size_t j = negative; j < chars.size(); j++) {
+      value = value * 10 + (chars[j] - '0');
+    }
+    // -0 is not a Smi.
+    if (!negative || value != 0) {
+      return AddValue(
+          handle(Smi::FromInt(negative ? -value : value), isolate_));
+    }
+  }
+  double number =
+      StringToDouble(chars,
+                     NO_CONVERSION_FLAGS,  // Hex, octal or trailing junk.
+                     std::numeric_limits<double>::quiet_NaN());
+  DCHECK(!std::isnan(number));
+  AddValue(factory()->NewNumber(number));
+}
+
+void JsonStreamingParser::EndLiteral() {
+  switch (literal_[0]) {
+    case 't':
+      return AddValue(factory()->true_value());
+    case 'f':
+      return AddValue(factory()->false_value());
+    case 'n':
+      return AddValue(factory()->null_value());
+  }
+  UNREACHABLE();
+}
+
+void JsonStreamingParser::OpenContainer(ContainerKind kind) {
+  Handle<Object> container;
+  Handle<Object> aux;
+  if (kind == ContainerKind::kArray) {
+    container = factory()->empty_fixed_array();
+    aux = handle(Smi::zero(), isolate_);
+    state_ = State::kValueOrEndArray;
+  } else {
+    container = factory()->NewJSObject(isolate_->object_function());
+    aux = factory()->undefined_value();
+    state_ = State::kKeyOrEndObject;
+  }
+  containers_.push_back(kind);
+
+  int index = FrameIndex();
+  Handle<FixedArray> stack =
+      FixedArray::SetAndGrow(isolate_, this->stack(), index + 1, aux);
+  stack->set(index, *container);
+  if (*stack != *stack_) {
+    GlobalHandles::Destroy(stack_.location());
+    stack_ = isolate_->global_handles()->Create(*stack);
+  }
+}
+
+void JsonStreamingParser::CloseContainer() {
+  Handle<FixedArray> stack = this->stack();
+  int index = FrameIndex();
+  Handle<Object> value;
+  if (containers_.back() == ContainerKind::kArray) {
+    Handle<FixedArray> elements(FixedArray::cast(stack->get(index)), isolate_);
+    int length = Smi::ToInt(stack->get(index + 1));
+    elements = FixedArray::RightTrimOrEmpty(isolate_, elements, length);
+    value = factory()->NewJSArrayWithElements(elements, PACKED_ELEMENTS,
+                                              length);
+  } else {
+    value = handle(stack->get(index), isolate_);
+  }
+  stack->set(index, Smi::zero());
+  stack->set(index + 1, Smi::zero());
+  containers_.pop_back();
+  AddValue(value);
+}
+
+void JsonStreamingParser::AddValue(Handle<Object> value) {
+  Handle<FixedArray> stack = this->stack();
+  if (containers_.empty()) {
+    stack->set(kResultIndex, *value);
+    state_ = State::kDone;
+    return;
+  }
+
+  int index = FrameIndex();
+  if (containers_.back() == ContainerKind::kArray) {
+    Handle<FixedArray> elements(FixedArray::cast(stack->get(index)), isolate_);
+    int length = Smi::ToInt(stack->get(index + 1));
+    elements = FixedArray::SetAndGrow(isolate_, elements, length, value);
+    stack->set(index, *elements);
+    stack->set(index + 1, Smi::FromInt(length + 1));
+  } else {
+    Handle<JSObject> object(JSObject::cast(stack->get(index)), isolate_);
+    Handle<String> key(String::cast(stack->get(index + 1)), isolate_);
+    // Like JSON.parse, define own data properties, which also covers keys
+    // such as "__proto__" and array indices.
+    if (JSReceiver::CreateDataProperty(isolate_, object, key, value,
+                                       Just(kThrowOnError))
+            .IsNothing()) {
+      return ReportPendingException();
+    }
+  }
+  state_ = State::kCommaOrEnd;
+}
+
+void JsonStreamingParser::ReportError(MessageTemplate message,
+                                      size_t position) {
+  DCHECK_GE(position, line_start_);
+  Handle<Object> arg = factory()->NewNumberFromSize(position);
+  Handle<Object> arg2 = factory()->NewNumberFromSize(line_);
+  Handle<Object> arg3 =
+      factory()->NewNumberFromSize(position - line_start_ + 1);
+  isolate_->Throw(*factory()->NewSyntaxError(message, arg, arg2, arg3));
+  ReportPendingException();
+}
+
+void JsonStreamingParser::ReportPendingException() {
+  DCHECK(isolate_->has_pending_exception());
+  // Keep the exception around so that later calls fail the same way, and
+  // drop the partial result.
+  Handle<FixedArray> stack = this->stack();
+  stack->set(kResultIndex, isolate_->pending_exception());
+  for (int i = kFirstFrameIndex; i < stack->length(); i++) {
+    stack->set(i, Smi::zero());
+  }
+  containers_.clear();
+  state_ = State::kError;
+}
+
+}  // namespace internal
+}  // namespace v8
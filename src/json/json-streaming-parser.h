@@ -0,0 +1,147 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/message-template.h"
+#include "src/handles/handles.h"
+#include "src/json/json-parser-tables.h"
+#include "src/third_party/utf8-decoder/utf8-decoder.h"
+
+namespace v8 {
+namespace internal {
+
+class FixedArray;
+class Isolate;
+
+// A JSON parser that consumes UTF-8 encoded input in arbitrarily sized
+// chunks, without ever materializing the source as a String.
+//
+// The parser is an explicit state machine rather than a recursive descent
+// parser, so that it can stop at any byte boundary and resume with the next
+// chunk. The containers that are under construction are kept alive in a
+// FixedArray held by a global handle, since the embedder may return to the
+// event loop between chunks.
+//
+// Error positions, lines and columns in the thrown SyntaxErrors are counted
+// in bytes of the UTF-8 input.
+class V8_EXPORT_PRIVATE JsonStreamingParser final {
+ public:
+  explicit JsonStreamingParser(Isolate* isolate);
+  ~JsonStreamingParser();
+
+  JsonStreamingParser(const JsonStreamingParser&) = delete;
+  JsonStreamingParser& operator=(const JsonStreamingParser&) = delete;
+
+  // Consumes the next chunk of input. Fails with a pending SyntaxError as
+  // soon as the input seen so far can't be the prefix of a JSON text.
+  V8_WARN_UNUSED_RESULT Maybe<bool> Write(base::Vector<const uint8_t> chunk);
+
+  // Signals the end of the input and returns the parsed value.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish();
+
+ private:
+  enum class State : uint8_t {
+    kValue,
+    kValueOrEndArray,
+    kKeyOrEndObject,
+    kKey,
+    kColon,
+    kCommaOrEnd,
+    kDone,
+    kString,
+    kStringEscape,
+    kStringUnicodeEscape,
+    kNumber,
+    kLiteral,
+    kError,
+  };
+
+  enum class ContainerKind : uint8_t { kArray, kObject };
+
+  // Layout of the parse stack: the result slot, followed by a
+  // (container, aux) pair per open container. For arrays, the container is
+  // the FixedArray of elements and aux the Smi element count; for objects,
+  // the container is the JSObject and aux the pending property key.
+  static constexpr int kResultIndex = 0;
+  static constexpr int kFirstFrameIndex = 1;
+  static constexpr int kFrameSize = 2;
+
+  // Short string values are internalized, like in the JsonParser.
+  static constexpr int kMaxInternalizedStringValueLength = 10;
+
+  const uint8_t* ScanString(const uint8_t* cursor, const uint8_t* end);
+  const uint8_t* ScanNumber(const uint8_t* cursor, const uint8_t* end);
+  const uint8_t* ScanWhitespace(const uint8_t* cursor, const uint8_t* end);
+  void Step(const uint8_t* cursor);
+
+  void BeginValue(const uint8_t* cursor);
+  void BeginString(bool is_key);
+  void EndString();
+  void EndNumber();
+  void EndLiteral();
+  void AddValue(Handle<Object> value);
+  void OpenContainer(ContainerKind kind);
+  void CloseContainer();
+
+  void AppendCharacter(base::uc16 c);
+  void AppendCodePoint(uint32_t code_point);
+  V8_WARN_UNUSED_RESULT MaybeHandle<String> MakeString();
+
+  void ReportError(MessageTemplate message, size_t position);
+  void ReportError(MessageTemplate message, const uint8_t* cursor) {
+    ReportError(message, PositionOf(cursor));
+  }
+  void ReportPendingException();
+
+  size_t PositionOf(const uint8_t* cursor) const {
+    return chunk_position_ + (cursor - chunk_start_);
+  }
+  Handle<FixedArray> stack() const { return stack_; }
+  int FrameIndex() const {
+    return kFirstFrameIndex +
+           static_cast<int>(containers_.size() - 1) * kFrameSize;
+  }
+  Factory* factory() const;
+
+  Isolate* const isolate_;
+  // Global handle.
+  Handle<FixedArray> stack_;
+  std::vector<ContainerKind> containers_;
+  State state_ = State::kValue;
+
+  // Position bookkeeping. Raw line terminators only appear in whitespace,
+  // so lines are counted while skipping it.
+  const uint8_t* chunk_start_ = nullptr;
+  size_t chunk_position_ = 0;
+  size_t line_ = 1;
+  size_t line_start_ = 0;
+  bool last_was_carriage_return_ = false;
+
+  // String state.
+  bool string_is_key_ = false;
+  Utf8DfaDecoder::State utf8_state_ = Utf8DfaDecoder::kAccept;
+  uint32_t utf8_buffer_ = 0;
+  int unicode_escape_digits_ = 0;
+  base::uc16 unicode_escape_value_ = 0;
+  std::vector<uint8_t> one_byte_buffer_;
+  std::vector<base::uc16> two_byte_buffer_;
+
+  // Number state.
+  size_t number_start_ = 0;
+  std::vector<uint8_t> number_buffer_;
+
+  // Literal state.
+  const char* literal_ = nullptr;
+  size_t literal_index_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
@@ -0,0 +1,288 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-string-scanner.h"
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/codegen/cpu-features.h"
+
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM, like src/objects/simd.cc.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+enum class ScanMode {
+  // Stop at characters that may end the contents of a string literal.
+  kTerminator,
+  // Additionally stop at surrogates, which JSON.stringify needs to inspect.
+  kEscape,
+};
+
+template <ScanMode mode, typename Char>
+V8_INLINE bool IsStopCharacter(Char c) {
+  return detail::IsJsonScanStopCharacter<mode == ScanMode::kEscape>(c);
+}
+
+// Scalar search, used as a fall-back when SIMD isn't available, and for the
+// characters that don't fill a whole vector.
+template <ScanMode mode, typename Char>
+V8_INLINE const Char* ScanScalar(const Char* cursor, const Char* end,
+                                 uint16_t* bits) {
+  uint16_t or_bits = 0;
+  for (; cursor < end; ++cursor) {
+    if (IsStopCharacter<mode>(*cursor)) break;
+    or_bits |= *cursor;
+  }
+  if (bits != nullptr) *bits |= or_bits;
+  return cursor;
+}
+
+// Ors the characters in [start, end) into |bits|, used for the part of a
+// vector before the stop character.
+V8_INLINE void OrCharacters(const uint16_t* start, const uint16_t* end,
+                            uint16_t* bits) {
+  for (; start < end; ++start) *bits |= *start;
+}
+
+V8_INLINE void OrCharacters(const uint8_t* start, const uint8_t* end,
+                            uint16_t* bits) {}
+
+#ifdef __SSE3__
+
+template <ScanMode mode, typename Char>
+const Char* ScanSSE(const Char* cursor, const Char* end, uint16_t* bits) {
+  constexpr int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  __m128i or_bits = _mm_setzero_si128();
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i stop;
+    if constexpr (sizeof(Char) == 1) {
+      // c <= 0x1F <=> min(c, 0x1F) == c, for unsigned bytes.
+      __m128i control =
+          _mm_cmpeq_epi8(_mm_min_epu8(chars, _mm_set1_epi8(0x1F)), chars);
+      stop = _mm_or_si128(
+          control, _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')),
+                                _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))));
+    } else {
+      // c <= 0x1F <=> saturating c - 0x1F == 0, for unsigned words.
+      __m128i control = _mm_cmpeq_epi16(
+          _mm_subs_epu16(chars, _mm_set1_epi16(0x1F)), _mm_setzero_si128());
+      stop = _mm_or_si128(
+          control, _mm_or_si128(_mm_cmpeq_epi16(chars, _mm_set1_epi16('"')),
+                                _mm_cmpeq_epi16(chars, _mm_set1_epi16('\\'))));
+      if constexpr (mode == ScanMode::kEscape) {
+        __m128i surrogate = _mm_cmpeq_epi16(
+            _mm_and_si128(chars, _mm_set1_epi16(static_cast<int16_t>(0xF800))),
+            _mm_set1_epi16(static_cast<int16_t>(0xD800)));
+        stop = _mm_or_si128(stop, surrogate);
+      }
+    }
+    int mask = _mm_movemask_epi8(stop);
+    if (mask != 0) {
+      const Char* match =
+          cursor + base::bits::CountTrailingZeros32(mask) / sizeof(Char);
+      if (bits != nullptr) OrCharacters(cursor, match, bits);
+      cursor = match;
+      break;
+    }
+    or_bits = _mm_or_si128(or_bits, chars);
+  }
+  if (sizeof(Char) == 2 && bits != nullptr) {
+    alignas(16) uint16_t lanes[8];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), or_bits);
+    for (uint16_t lane : lanes) *bits |= lane;
+  }
+  return cursor;
+}
+
+#if defined(_MSC_VER) && defined(__clang__)
+// Generating AVX2 code with Clang on Windows without the /arch:AVX2 flag does
+// not seem possible at the moment.
+#define IS_CLANG_WIN 1
+#endif
+
+// Since we don't compile with -mavx2, the AVX2 version is compiled with a
+// target attribute and only called if the CPU supports AVX2.
+#if !defined(_M_IX86) && !defined(IS_CLANG_WIN)
+#define V8_JSON_SCAN_AVX2 1
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+template <ScanMode mode, typename Char>
+TARGET_AVX2 const Char* ScanAVX2(const Char* cursor, const Char* end,
+                                 uint16_t* bits) {
+  constexpr int kCharsPerVector = sizeof(__m256i) / sizeof(Char);
+  __m256i or_bits = _mm256_setzero_si256();
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m256i chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cursor));
+    __m256i stop;
+    if constexpr (sizeof(Char) == 1) {
+      __m256i control = _mm256_cmpeq_epi8(
+          _mm256_min_epu8(chars, _mm256_set1_epi8(0x1F)), chars);
+      stop = _mm256_or_si256(
+          control,
+          _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"')),
+                          _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\'))));
+    } else {
+      __m256i control =
+          _mm256_cmpeq_epi16(_mm256_subs_epu16(chars, _mm256_set1_epi16(0x1F)),
+                             _mm256_setzero_si256());
+      stop = _mm256_or_si256(
+          control,
+          _mm256_or_si256(_mm256_cmpeq_epi16(chars, _mm256_set1_epi16('"')),
+                          _mm256_cmpeq_epi16(chars, _mm256_set1_epi16('\\'))));
+      if constexpr (mode == ScanMode::kEscape) {
+        __m256i surrogate = _mm256_cmpeq_epi16(
+            _mm256_and_si256(chars,
+                             _mm256_set1_epi16(static_cast<int16_t>(0xF800))),
+            _mm256_set1_epi16(static_cast<int16_t>(0xD800)));
+        stop = _mm256_or_si256(stop, surrogate);
+      }
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(stop));
+    if (mask != 0) {
+      const Char* match =
+          cursor + base::bits::CountTrailingZeros32(mask) / sizeof(Char);
+      if (bits != nullptr) OrCharacters(cursor, match, bits);
+      cursor = match;
+      break;
+    }
+    or_bits = _mm256_or_si256(or_bits, chars);
+  }
+  if (sizeof(Char) == 2 && bits != nullptr) {
+    alignas(32) uint16_t lanes[16];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), or_bits);
+    for (uint16_t lane : lanes) *bits |= lane;
+  }
+  return cursor;
+}
+
+#undef TARGET_AVX2
+#endif  // !defined(_M_IX86) && !defined(IS_CLANG_WIN)
+#undef IS_CLANG_WIN
+
+#endif  // __SSE3__
+
+#ifdef NEON64
+
+template <ScanMode mode, typename Char>
+const Char* ScanNeon(const Char* cursor, const Char* end, uint16_t* bits) {
+  constexpr int kCharsPerVector = 16 / sizeof(Char);
+  uint16x8_t or_bits = vdupq_n_u16(0);
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    bool found;
+    if constexpr (sizeof(Char) == 1) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t stop =
+          vorrq_u8(vcleq_u8(chars, vdupq_n_u8(0x1F)),
+                   vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')),
+                            vceqq_u8(chars, vdupq_n_u8('\\'))));
+      found = vmaxvq_u8(stop) != 0;
+    } else {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t stop =
+          vorrq_u16(vcleq_u16(chars, vdupq_n_u16(0x1F)),
+                    vorrq_u16(vceqq_u16(chars, vdupq_n_u16('"')),
+                              vceqq_u16(chars, vdupq_n_u16('\\'))));
+      if constexpr (mode == ScanMode::kEscape) {
+        stop = vorrq_u16(stop, vceqq_u16(vandq_u16(chars, vdupq_n_u16(0xF800)),
+                                         vdupq_n_u16(0xD800)));
+      }
+      found = vmaxvq_u16(stop) != 0;
+      if (!found) or_bits = vorrq_u16(or_bits, chars);
+    }
+    // Neon has no movemask; let the scalar loop find the exact position
+    // within the vector.
+    if (found) break;
+  }
+  if (sizeof(Char) == 2 && bits != nullptr) {
+    uint16_t lanes[8];
+    vst1q_u16(lanes, or_bits);
+    for (uint16_t lane : lanes) *bits |= lane;
+  }
+  return cursor;
+}
+
+#endif  // NEON64
+
+template <ScanMode mode, typename Char>
+const Char* Scan(const Char* start, const Char* end, uint16_t* bits) {
+  const Char* cursor = start;
+#ifdef __SSE3__
+#if defined(V8_JSON_SCAN_AVX2) && \
+    (defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64))
+  if (CpuFeatures::IsSupported(AVX2)) {
+    cursor = ScanAVX2<mode>(cursor, end, bits);
+  } else {
+    cursor = ScanSSE<mode>(cursor, end, bits);
+  }
+#else
+  cursor = ScanSSE<mode>(cursor, end, bits);
+#endif
+#elif defined(NEON64)
+  cursor = ScanNeon<mode>(cursor, end, bits);
+#endif
+  // The vectorized loops stop at the vector containing the stop character, or
+  // when there are not enough characters left to fill a vector.
+  return ScanScalar<mode>(cursor, end, bits);
+}
+
+#undef V8_JSON_SCAN_AVX2
+
+}  // namespace
+
+namespace detail {
+
+const uint8_t* FindJsonStringTerminatorOutOfLine(const uint8_t* start,
+                                                 const uint8_t* end) {
+  return Scan<ScanMode::kTerminator>(start, end, nullptr);
+}
+
+const uint16_t* FindJsonStringTerminatorOutOfLine(const uint16_t* start,
+                                                  const uint16_t* end,
+                                                  uint16_t* bits) {
+  DCHECK_NOT_NULL(bits);
+  return Scan<ScanMode::kTerminator>(start, end, bits);
+}
+
+const uint8_t* FindJsonEscapeCharacterOutOfLine(const uint8_t* start,
+                                                const uint8_t* end) {
+  return Scan<ScanMode::kEscape>(start, end, nullptr);
+}
+
+const uint16_t* FindJsonEscapeCharacterOutOfLine(const uint16_t* start,
+                                                 const uint16_t* end) {
+  return Scan<ScanMode::kEscape>(start, end, nullptr);
+}
+
+}  // namespace detail
+
+}  // namespace internal
+}  // namespace v8
+
+#undef NEON64
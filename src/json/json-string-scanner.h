@@ -0,0 +1,109 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STRING_SCANNER_H_
+#define V8_JSON_JSON_STRING_SCANNER_H_
+
+#include <cstdint>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Searches over the contents of JSON string literals, shared by the
+// JsonParser and the JsonStringifier. The first kJsonScanInlineLength
+// characters are checked inline, so that short strings (which includes most
+// property names) don't pay for a call. The rest is searched out of line with
+// SSE3/AVX2 or Neon where available, and a scalar loop otherwise and for the
+// tail of the input.
+constexpr int kJsonScanInlineLength = 16;
+
+namespace detail {
+
+template <bool stop_at_surrogates, typename Char>
+V8_INLINE bool IsJsonScanStopCharacter(Char c) {
+  if (c < 0x20 || c == '"' || c == '\\') return true;
+  if constexpr (stop_at_surrogates && sizeof(Char) == 2) {
+    return (c & 0xF800) == 0xD800;
+  }
+  return false;
+}
+
+// Scalar search over at most kJsonScanInlineLength characters. Returns the
+// stop character, or the first unchecked character if there is none.
+template <bool stop_at_surrogates, typename Char>
+V8_INLINE const Char* ScanJsonStringPrefix(const Char* start, const Char* end,
+                                           uint16_t* bits) {
+  const Char* prefix_end =
+      end - start > kJsonScanInlineLength ? start + kJsonScanInlineLength : end;
+  for (; start < prefix_end; ++start) {
+    if (IsJsonScanStopCharacter<stop_at_surrogates>(*start)) break;
+    if (bits != nullptr) *bits |= *start;
+  }
+  return start;
+}
+
+V8_EXPORT_PRIVATE const uint8_t* FindJsonStringTerminatorOutOfLine(
+    const uint8_t* start, const uint8_t* end);
+V8_EXPORT_PRIVATE const uint16_t* FindJsonStringTerminatorOutOfLine(
+    const uint16_t* start, const uint16_t* end, uint16_t* bits);
+V8_EXPORT_PRIVATE const uint8_t* FindJsonEscapeCharacterOutOfLine(
+    const uint8_t* start, const uint8_t* end);
+V8_EXPORT_PRIVATE const uint16_t* FindJsonEscapeCharacterOutOfLine(
+    const uint16_t* start, const uint16_t* end);
+
+}  // namespace detail
+
+// Returns the first character in [start, end) that may terminate a JSON
+// string literal, i.e. '"', '\\' or a control character, or |end| if there is
+// none.
+V8_INLINE const uint8_t* FindJsonStringTerminator(const uint8_t* start,
+                                                  const uint8_t* end) {
+  const uint8_t* cursor =
+      detail::ScanJsonStringPrefix<false>(start, end, nullptr);
+  if (cursor == end || detail::IsJsonScanStopCharacter<false>(*cursor)) {
+    return cursor;
+  }
+  return detail::FindJsonStringTerminatorOutOfLine(cursor, end);
+}
+// As above, but also ors all characters before the returned one into |*bits|,
+// which tells the caller whether any of them is outside of Latin1.
+V8_INLINE const uint16_t* FindJsonStringTerminator(const uint16_t* start,
+                                                   const uint16_t* end,
+                                                   uint16_t* bits) {
+  const uint16_t* cursor =
+      detail::ScanJsonStringPrefix<false>(start, end, bits);
+  if (cursor == end || detail::IsJsonScanStopCharacter<false>(*cursor)) {
+    return cursor;
+  }
+  return detail::FindJsonStringTerminatorOutOfLine(cursor, end, bits);
+}
+
+// Returns the first character in [start, end) that JSON.stringify can't copy
+// to its output as is, i.e. '"', '\\', a control character or a surrogate, or
+// |end| if there is none.
+V8_INLINE const uint8_t* FindJsonEscapeCharacter(const uint8_t* start,
+                                                 const uint8_t* end) {
+  const uint8_t* cursor =
+      detail::ScanJsonStringPrefix<true>(start, end, nullptr);
+  if (cursor == end || detail::IsJsonScanStopCharacter<true>(*cursor)) {
+    return cursor;
+  }
+  return detail::FindJsonEscapeCharacterOutOfLine(cursor, end);
+}
+V8_INLINE const uint16_t* FindJsonEscapeCharacter(const uint16_t* start,
+                                                  const uint16_t* end) {
+  const uint16_t* cursor =
+      detail::ScanJsonStringPrefix<true>(start, end, nullptr);
+  if (cursor == end || detail::IsJsonScanStopCharacter<true>(*cursor)) {
+    return cursor;
+  }
+  return detail::FindJsonEscapeCharacterOutOfLine(cursor, end);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STRING_SCANNER_H_
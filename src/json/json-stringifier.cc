@@ -7,6 +7,7 @@
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
+#include "src/json/json-string-scanner.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
@@ -119,6 +120,22 @@ class JsonStringifier {
     }
   }
 
+  // Appends |length| characters in bulk, extending the current part as
+  // needed.
+  template <typename SrcChar, typename DestChar>
+  V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+    DCHECK_EQ(encoding_ == String::ONE_BYTE_ENCODING, sizeof(DestChar) == 1);
+    while (length > 0) {
+      int chunk_length = std::min(length, part_length_ - current_index_);
+      CopyChars(reinterpret_cast<DestChar*>(part_ptr_) + current_index_, chars,
+                chunk_length);
+      current_index_ += chunk_length;
+      chars += chunk_length;
+      length -= chunk_length;
+      if (current_index_ == part_length_) Extend();
+    }
+  }
+
   V8_INLINE bool CurrentPartCanFit(int length) {
     return part_length_ - current_index_ > length;
   }
@@ -241,6 +258,12 @@ class JsonStringifier {
       cursor_ += length;
     }
 
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
+
    private:
     int* current_index_;
     DestChar* start_;
@@ -1257,14 +1280,24 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // Assert that base::uc16 character is not truncated down to 8 bit.
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
+  if constexpr (raw_json) {
+    dest->AppendChars(src.begin(), src.length());
+    return false;
+  }
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
+    // Copy the characters up to the next one that needs escaping in bulk.
+    const SrcChar* run_start = src.begin() + i;
+    int run_length = static_cast<int>(
+        FindJsonEscapeCharacter(run_start, src.end()) - run_start);
+    dest->AppendChars(run_start, run_length);
+    i += run_length;
+    if (i == src.length()) break;
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
-    } else if (sizeof(SrcChar) != 1 &&
-               base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                               static_cast<SrcChar>(0xDFFF))) {
+    DCHECK(!DoNotEscape(c));
+    if (sizeof(SrcChar) != 1 &&
+        base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                        static_cast<SrcChar>(0xDFFF))) {
       // The current character is a surrogate.
       required_escaping = true;
       if (c <= 0xDBFF) {
@@ -1329,12 +1362,20 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
         &current_index_);
     required_escaping = SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
         vector, &no_extend);
+  } else if constexpr (raw_json) {
+    AppendChars<SrcChar, DestChar>(vector.begin(), vector.length());
   } else {
     for (int i = 0; i < vector.length(); i++) {
+      // Copy the characters up to the next one that needs escaping in bulk.
+      const SrcChar* run_start = vector.begin() + i;
+      int run_length = static_cast<int>(
+          FindJsonEscapeCharacter(run_start, vector.end()) - run_start);
+      AppendChars<SrcChar, DestChar>(run_start, run_length);
+      i += run_length;
+      if (i == vector.length()) break;
       SrcChar c = vector.at(i);
-      if (raw_json || DoNotEscape(c)) {
-        Append<SrcChar, DestChar>(c);
-      } else if (sizeof(SrcChar) != 1 &&
+      DCHECK(!DoNotEscape(c));
+      if (sizeof(SrcChar) != 1 &&
                  base::IsInRange(c, static_cast<SrcChar>(0xD800),
                                  static_cast<SrcChar>(0xDFFF))) {
         // The current character is a surrogate.
@@ -0,0 +1,196 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/libplatform/code-cache-store.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+// Every file starts with this header, followed by |payload_length| bytes of
+// code cache.
+struct FileHeader {
+  static constexpr uint32_t kMagicNumber = 0xC0DECAC1;
+
+  uint32_t magic_number;
+  uint32_t version_tag;
+  uint64_t source_hash;
+  uint32_t source_length;
+  uint32_t payload_length;
+};
+static_assert(sizeof(FileHeader) == 24);
+
+class MappedEntry final : public CodeCacheStore::Entry {
+ public:
+  explicit MappedEntry(std::unique_ptr<base::OS::MemoryMappedFile> file)
+      : file_(std::move(file)) {}
+
+  const uint8_t* data() const override {
+    return static_cast<const uint8_t*>(file_->memory()) + sizeof(FileHeader);
+  }
+  size_t length() const override { return file_->size() - sizeof(FileHeader); }
+
+ private:
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+};
+
+class DefaultCodeCacheStore final : public CodeCacheStore {
+ public:
+  DefaultCodeCacheStore(v8::Platform* platform, const char* directory)
+      : platform_(platform), directory_(directory) {
+    if (!directory_.empty() &&
+        !base::OS::isDirectorySeparator(directory_.back())) {
+      directory_ += base::OS::DirectorySeparator();
+    }
+  }
+
+  ~DefaultCodeCacheStore() override { WaitForPendingWrites(); }
+
+  std::unique_ptr<Entry> Lookup(const Key& key) override {
+    std::unique_ptr<base::OS::MemoryMappedFile> file(
+        base::OS::MemoryMappedFile::open(
+            FileName(key).c_str(),
+            base::OS::MemoryMappedFile::FileMode::kReadOnly));
+    if (!file || file->size() < sizeof(FileHeader)) return nullptr;
+    FileHeader header;
+    memcpy(&header, file->memory(), sizeof(header));
+    if (header.magic_number != FileHeader::kMagicNumber ||
+        header.version_tag != key.version_tag ||
+        header.source_hash != key.source_hash ||
+        header.source_length != key.source_length ||
+        header.payload_length != file->size() - sizeof(FileHeader)) {
+      return nullptr;
+    }
+    return std::make_unique<MappedEntry>(std::move(file));
+  }
+
+  void Store(const Key& key, const uint8_t* data, size_t length) override {
+    if (length > UINT32_MAX - sizeof(FileHeader)) return;
+    {
+      base::MutexGuard guard(&mutex_);
+      pending_writes_++;
+    }
+    platform_->CallOnWorkerThread(std::make_unique<WriteTask>(
+        this, key, std::vector<uint8_t>(data, data + length)));
+  }
+
+  void Remove(const Key& key) override {
+    base::OS::Remove(FileName(key).c_str());
+  }
+
+  void WaitForPendingWrites() override {
+    base::MutexGuard guard(&mutex_);
+    while (pending_writes_ > 0) writes_done_.Wait(&mutex_);
+  }
+
+ private:
+  class WriteTask final : public Task {
+   public:
+    WriteTask(DefaultCodeCacheStore* store, const Key& key,
+              std::vector<uint8_t> data)
+        : store_(store), key_(key), data_(std::move(data)) {}
+
+    void Run() override {
+      store_->Write(key_, data_);
+      base::MutexGuard guard(&store_->mutex_);
+      if (--store_->pending_writes_ == 0) store_->writes_done_.NotifyAll();
+    }
+
+   private:
+    DefaultCodeCacheStore* store_;
+    const Key key_;
+    const std::vector<uint8_t> data_;
+  };
+
+  std::string FileName(const Key& key) const {
+    char name[64];
+    base::OS::SNPrintF(name, sizeof(name), "%08x-%08x%08x-%08x.v8cache",
+                       key.version_tag,
+                       static_cast<uint32_t>(key.source_hash >> 32),
+                       static_cast<uint32_t>(key.source_hash),
+                       key.source_length);
+    return directory_ + name;
+  }
+
+  // Writes to a file with a unique name first, so that readers (also in
+  // other processes) never see partially written entries.
+  void Write(const Key& key, const std::vector<uint8_t>& data) {
+    std::string file_name = FileName(key);
+    char suffix[32];
+    base::OS::SNPrintF(suffix, sizeof(suffix), ".%d-%d.tmp",
+                       base::OS::GetCurrentProcessId(),
+                       next_temp_file_id_.fetch_add(1));
+    std::string temp_file_name = file_name + suffix;
+    FILE* file = base::OS::FOpen(temp_file_name.c_str(), "wb");
+    if (file == nullptr) return;
+    FileHeader header{FileHeader::kMagicNumber, key.version_tag,
+                      key.source_hash, key.source_length,
+                      static_cast<uint32_t>(data.size())};
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(data.data(), 1, data.size(), file) == data.size();
+    success = fclose(file) == 0 && success;
+    if (success && rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+      // Windows doesn't replace existing files on rename.
+      base::OS::Remove(file_name.c_str());
+      success = rename(temp_file_name.c_str(), file_name.c_str()) == 0;
+    }
+    if (!success) base::OS::Remove(temp_file_name.c_str());
+  }
+
+  v8::Platform* const platform_;
+  std::string directory_;
+  std::atomic<int> next_temp_file_id_{0};
+  base::Mutex mutex_;
+  base::ConditionVariable writes_done_;
+  int pending_writes_ = 0;
+};
+
+V8_INLINE uint64_t MixBits(uint64_t x) {
+  // The finalizer of MurmurHash3.
+  x ^= x >> 33;
+  x *= uint64_t{0xFF51AFD7ED558CCD};
+  x ^= x >> 33;
+  x *= uint64_t{0xC4CEB9FE1A85EC53};
+  x ^= x >> 33;
+  return x;
+}
+
+}  // namespace
+
+// static
+uint64_t CodeCacheStore::HashSource(const void* data, size_t length) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint64_t hash = MixBits(length);
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(word));
+    hash = MixBits(hash ^ word) + i;
+  }
+  uint64_t tail = 0;
+  memcpy(&tail, bytes + i, length - i);
+  return MixBits(hash ^ tail);
+}
+
+std::unique_ptr<CodeCacheStore> NewCodeCacheStore(v8::Platform* platform,
+                                                  const char* directory) {
+  return std::make_unique<DefaultCodeCacheStore>(platform, directory);
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -29,6 +29,7 @@
 #include "src/maglev/maglev-code-generator.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compilation-unit.h"
+#include "src/maglev/maglev-dead-allocation-elimination.h"
 #include "src/maglev/maglev-graph-builder.h"
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-graph-printer.h"
@@ -452,7 +453,9 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
   if (v8_flags.print_maglev_code || v8_flags.code_comments ||
       v8_flags.print_maglev_graph || v8_flags.print_maglev_graphs ||
       v8_flags.trace_maglev_graph_building ||
-      v8_flags.trace_maglev_phi_untagging || v8_flags.trace_maglev_regalloc) {
+      v8_flags.trace_maglev_phi_untagging ||
+      v8_flags.trace_maglev_dead_allocation_elimination ||
+      v8_flags.trace_maglev_regalloc) {
     compilation_info->set_graph_labeller(labeller_ = new MaglevGraphLabeller());
   }
 
@@ -509,6 +512,25 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
   }
 #endif
 
+  if (v8_flags.maglev_dead_allocation_elimination) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.Maglev.DeadAllocationElimination");
+    GraphProcessor<MaglevDeadAllocationAnalysis> analysis(compilation_info);
+    analysis.ProcessGraph(graph);
+
+    if (analysis.node_processor().has_removable_nodes()) {
+      GraphProcessor<MaglevDeadAllocationElimination> elimination(
+          &analysis.node_processor());
+      elimination.ProcessGraph(graph);
+
+      if (v8_flags.print_maglev_graphs) {
+        UnparkedScopeIfOnBackground unparked_scope(local_isolate->heap());
+        std::cout << "\nAfter dead allocation elimination" << std::endl;
+        PrintGraph(std::cout, compilation_info, graph);
+      }
+    }
+  }
+
   {
     // Post-hoc optimisation:
     //   - Dead node marking
@@ -0,0 +1,98 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-dead-allocation-elimination.h"
+
+#include "src/flags/flags.h"
+#include "src/maglev/maglev-graph-labeller.h"
+#include "src/maglev/maglev-graph-printer.h"
+#include "src/maglev/maglev-ir-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+#define TRACE_DEAD_ALLOCATION_ELIMINATION(...)               \
+  do {                                                       \
+    if (v8_flags.trace_maglev_dead_allocation_elimination) { \
+      StdoutStream{} << __VA_ARGS__ << std::endl;            \
+    }                                                        \
+  } while (false)
+
+ProcessResult MaglevDeadAllocationAnalysis::Process(AllocateRaw* node,
+                                            const ProcessingState&) {
+  AllocationGroup* group = zone()->New<AllocationGroup>(zone());
+  group->members.push_back(node);
+  groups_.push_back(group);
+  group_of_[node] = group;
+  return ProcessResult::kContinue;
+}
+
+ProcessResult MaglevDeadAllocationAnalysis::Process(FoldedAllocation* node,
+                                            const ProcessingState&) {
+  AllocationGroup* group = GroupOf(node->raw_allocation().node());
+  DCHECK_NOT_NULL(group);
+  group->members.push_back(node);
+  // The use of the raw allocation by the folded allocation doesn't keep it
+  // alive.
+  group->accounted_uses++;
+  group_of_[node] = group;
+  return ProcessResult::kContinue;
+}
+
+void MaglevDeadAllocationAnalysis::RecordStore(NodeBase* store,
+                                               ValueNode* object,
+                                               ValueNode* value) {
+  AllocationGroup* object_group = GroupOf(object);
+  // Stores into objects we don't track leave the value's use unaccounted for,
+  // which keeps it alive.
+  if (object_group == nullptr) return;
+  object_group->stores.push_back(store);
+  object_group->accounted_uses++;
+  if (value == nullptr) return;
+  AllocationGroup* value_group = GroupOf(value);
+  if (value_group == nullptr) return;
+  // The value is only alive if the object it is stored into is alive.
+  value_group->accounted_uses++;
+  object_group->stored_values.push_back(value_group);
+}
+
+void MaglevDeadAllocationAnalysis::PostProcessGraph(Graph* graph) {
+  ZoneVector<AllocationGroup*> worklist(zone());
+  for (AllocationGroup* group : groups_) {
+    int uses = 0;
+    for (ValueNode* member : group->members) uses += member->use_count();
+    DCHECK_LE(group->accounted_uses, uses);
+    if (uses != group->accounted_uses) {
+      group->is_live = true;
+      worklist.push_back(group);
+    }
+  }
+
+  // Everything stored into a live object is live as well.
+  while (!worklist.empty()) {
+    AllocationGroup* group = worklist.back();
+    worklist.pop_back();
+    for (AllocationGroup* value_group : group->stored_values) {
+      if (value_group->is_live) continue;
+      value_group->is_live = true;
+      worklist.push_back(value_group);
+    }
+  }
+
+  for (AllocationGroup* group : groups_) {
+    if (group->is_live) continue;
+    TRACE_DEAD_ALLOCATION_ELIMINATION(
+        "Removing dead allocation "
+        << PrintNodeLabel(graph_labeller(), group->members.front()) << " ("
+        << group->members.size() << " objects, " << group->stores.size()
+        << " stores)");
+    for (ValueNode* member : group->members) removable_.insert(member);
+    for (NodeBase* store : group->stores) removable_.insert(store);
+  }
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,140 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_DEAD_ALLOCATION_ELIMINATION_H_
+#define V8_MAGLEV_MAGLEV_DEAD_ALLOCATION_ELIMINATION_H_
+
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-graph-processor.h"
+#include "src/maglev/maglev-ir.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class Graph;
+
+// Finds inline allocations (AllocateRaw and the FoldedAllocations carved out
+// of it) whose contents can never be observed.
+//
+// An allocation group (one AllocateRaw plus its folded allocations) is dead if
+// every use of every object in the group is either the object input of a store
+// (i.e. an initializing or later field store into the object itself), or the
+// value input of such a store into another dead group. Any other use -- loads,
+// calls, phis, returns, and in particular deopt frame states -- keeps the
+// group alive.
+//
+// This is not an escape analysis: there are no virtual objects, and nothing is
+// materialized on deopt. An allocation that is live in any frame state (which
+// is the case for most allocations that are used at all) is left alone.
+class MaglevDeadAllocationAnalysis {
+ public:
+  explicit MaglevDeadAllocationAnalysis(MaglevCompilationInfo* compilation_info)
+      : compilation_info_(compilation_info),
+        groups_(zone()),
+        group_of_(zone()),
+        removable_(zone()) {}
+
+  void PreProcessGraph(Graph* graph) {}
+  void PostProcessGraph(Graph* graph);
+  void PreProcessBasicBlock(BasicBlock* block) {}
+
+  ProcessResult Process(AllocateRaw* node, const ProcessingState&);
+  ProcessResult Process(FoldedAllocation* node, const ProcessingState&);
+  ProcessResult Process(StoreMap* node, const ProcessingState&) {
+    RecordStore(node, node->object_input().node(), nullptr);
+    return ProcessResult::kContinue;
+  }
+  ProcessResult Process(StoreFloat64* node, const ProcessingState&) {
+    RecordStore(node, node->object_input().node(), nullptr);
+    return ProcessResult::kContinue;
+  }
+  ProcessResult Process(StoreTaggedFieldNoWriteBarrier* node,
+                        const ProcessingState&) {
+    RecordStore(node, node->object_input().node(),
+                node->value_input().node());
+    return ProcessResult::kContinue;
+  }
+  ProcessResult Process(StoreTaggedFieldWithWriteBarrier* node,
+                        const ProcessingState&) {
+    RecordStore(node, node->object_input().node(),
+                node->value_input().node());
+    return ProcessResult::kContinue;
+  }
+
+  template <class NodeT>
+  ProcessResult Process(NodeT* node, const ProcessingState& state) {
+    return ProcessResult::kContinue;
+  }
+
+  bool has_removable_nodes() const { return !removable_.empty(); }
+  bool IsRemovable(NodeBase* node) const {
+    return removable_.find(node) != removable_.end();
+  }
+
+ private:
+  struct AllocationGroup {
+    explicit AllocationGroup(Zone* zone)
+        : members(zone), stores(zone), stored_values(zone) {}
+
+    // The AllocateRaw followed by its FoldedAllocations.
+    ZoneVector<ValueNode*> members;
+    // Stores whose object input is a member of this group.
+    ZoneVector<NodeBase*> stores;
+    // Groups whose members are stored into members of this group.
+    ZoneVector<AllocationGroup*> stored_values;
+    // Uses of members which don't keep them alive by themselves.
+    int accounted_uses = 0;
+    bool is_live = false;
+  };
+
+  void RecordStore(NodeBase* store, ValueNode* object, ValueNode* value);
+  AllocationGroup* GroupOf(ValueNode* node) const {
+    auto it = group_of_.find(node);
+    if (it == group_of_.end()) return nullptr;
+    return it->second;
+  }
+
+  Zone* zone() const { return compilation_info_->zone(); }
+  MaglevGraphLabeller* graph_labeller() const {
+    return compilation_info_->graph_labeller();
+  }
+
+  MaglevCompilationInfo* compilation_info_;
+  ZoneVector<AllocationGroup*> groups_;
+  ZoneUnorderedMap<ValueNode*, AllocationGroup*> group_of_;
+  ZoneUnorderedSet<NodeBase*> removable_;
+};
+
+// Removes the allocations (and their stores) that MaglevDeadAllocationAnalysis
+// found to be dead.
+class MaglevDeadAllocationElimination {
+ public:
+  explicit MaglevDeadAllocationElimination(
+      const MaglevDeadAllocationAnalysis* analysis)
+      : analysis_(analysis) {}
+
+  void PreProcessGraph(Graph* graph) {}
+  void PostProcessGraph(Graph* graph) {}
+  void PreProcessBasicBlock(BasicBlock* block) {}
+
+  template <class NodeT>
+  ProcessResult Process(NodeT* node, const ProcessingState& state) {
+    if (!analysis_->IsRemovable(node)) return ProcessResult::kContinue;
+    for (Input& input : *node) {
+      input.node()->remove_use();
+    }
+    return ProcessResult::kRemove;
+  }
+
+ private:
+  const MaglevDeadAllocationAnalysis* analysis_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MAGLEV_MAGLEV_DEAD_ALLOCATION_ELIMINATION_H_
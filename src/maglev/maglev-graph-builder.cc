@@ -591,14 +591,15 @@ MaglevGraphBuilder::MaglevGraphBuilder(LocalIsolate* local_isolate,
       compilation_unit_(compilation_unit),
       parent_(parent),
       graph_(graph),
-      bytecode_analysis_(bytecode().object(), zone(),
-                         compilation_unit->osr_offset(), true),
+      bytecode_analysis_(broker()->GetBytecodeAnalysis(
+          bytecode(), compilation_unit->osr_offset(), true)),
       iterator_(bytecode().object()),
       source_position_iterator_(bytecode().SourcePositionTable(broker())),
       allow_loop_peeling_(is_inline() ? parent_->allow_loop_peeling_
                                       : v8_flags.maglev_loop_peeling),
       decremented_predecessor_offsets_(zone()),
       loop_headers_to_peel_(bytecode().length(), zone()),
+      allocation_store_graph_(zone()),
       call_frequency_(call_frequency),
       // Add an extra jump_target slot for the inline exit if needed.
       jump_targets_(zone()->AllocateArray<BasicBlockRef>(
@@ -3357,8 +3358,57 @@ bool MaglevGraphBuilder::CanElideWriteBarrier(ValueNode* object,
   return false;
 }
 
+// Like turboshaft's PretenuringPropagationReducer: young allocations that are
+// stored into old allocations are likely to live as long as them, so we
+// allocate them old directly instead of promoting them on the next GCs. This
+// also keeps them out of the remembered set. Unlike turboshaft, we propagate
+// eagerly while building the graph, and only through stores, not through
+// phis. Changing an AllocateRaw from young to old is safe as long as it
+// happens for the whole folded allocation: write barriers are only elided for
+// stores within the same allocation, and old space allocations are black
+// during incremental marking.
+void MaglevGraphBuilder::PropagatePretenuring(ValueNode* object,
+                                              ValueNode* value) {
+  if (!v8_flags.maglev_pretenure_store_values) return;
+  AllocateRaw* object_allocation = GetAllocation(object);
+  AllocateRaw* value_allocation = GetAllocation(value);
+  if (object_allocation == nullptr || value_allocation == nullptr ||
+      object_allocation == value_allocation ||
+      value_allocation->allocation_type() == AllocationType::kOld) {
+    return;
+  }
+  if (object_allocation->allocation_type() == AllocationType::kOld) {
+    MarkAllocationOld(value_allocation);
+  } else {
+    auto it = allocation_store_graph_
+                  .emplace(object_allocation, ZoneVector<AllocateRaw*>(zone()))
+                  .first;
+    it->second.push_back(value_allocation);
+  }
+}
+
+void MaglevGraphBuilder::MarkAllocationOld(AllocateRaw* allocation) {
+  SmallZoneVector<AllocateRaw*, 8> worklist(zone());
+  allocation->set_allocation_type(AllocationType::kOld);
+  worklist.push_back(allocation);
+  while (!worklist.empty()) {
+    AllocateRaw* current = worklist.back();
+    worklist.pop_back();
+    auto it = allocation_store_graph_.find(current);
+    if (it == allocation_store_graph_.end()) continue;
+    for (AllocateRaw* stored : it->second) {
+      // Allocations that are already old have been processed already.
+      if (stored->allocation_type() == AllocationType::kOld) continue;
+      stored->set_allocation_type(AllocationType::kOld);
+      worklist.push_back(stored);
+    }
+    allocation_store_graph_.erase(it);
+  }
+}
+
 void MaglevGraphBuilder::BuildStoreTaggedField(ValueNode* object,
                                                ValueNode* value, int offset) {
+  PropagatePretenuring(object, value);
   if (CanElideWriteBarrier(object, value)) {
     AddNewNode<StoreTaggedFieldNoWriteBarrier>({object, value}, offset);
   } else {
@@ -3376,6 +3426,7 @@ void MaglevGraphBuilder::BuildStoreTaggedFieldNoWriteBarrier(ValueNode* object,
 void MaglevGraphBuilder::BuildStoreFixedArrayElement(ValueNode* elements,
                                                      ValueNode* index,
                                                      ValueNode* value) {
+  PropagatePretenuring(elements, value);
   if (CanElideWriteBarrier(elements, value)) {
     AddNewNode<StoreFixedArrayElementNoWriteBarrier>({elements, index, value});
   } else {
@@ -1765,6 +1765,8 @@ class MaglevGraphBuilder {
   ReduceResult BuildCheckValue(ValueNode* node, compiler::HeapObjectRef ref);
 
   bool CanElideWriteBarrier(ValueNode* object, ValueNode* value);
+  void PropagatePretenuring(ValueNode* object, ValueNode* value);
+  void MarkAllocationOld(AllocateRaw* allocation);
   void BuildStoreTaggedField(ValueNode* object, ValueNode* value, int offset);
   void BuildStoreTaggedFieldNoWriteBarrier(ValueNode* object, ValueNode* value,
                                            int offset);
@@ -2105,7 +2107,7 @@ class MaglevGraphBuilder {
   compiler::JSHeapBroker* broker_ = compilation_unit_->broker();
 
   Graph* const graph_;
-  compiler::BytecodeAnalysis bytecode_analysis_;
+  const compiler::BytecodeAnalysis& bytecode_analysis_;
   interpreter::BytecodeArrayIterator iterator_;
   SourcePositionTableIterator source_position_iterator_;
   uint32_t* predecessors_;
@@ -2137,6 +2139,11 @@ class MaglevGraphBuilder {
   ForInState current_for_in_state = ForInState();
 
   AllocateRaw* current_raw_allocation_ = nullptr;
+  // Young allocations (values) that were stored into other young allocations
+  // (keys), so that they can be pretenured together if the key is pretenured
+  // later on.
+  ZoneUnorderedMap<AllocateRaw*, ZoneVector<AllocateRaw*>>
+      allocation_store_graph_;
 
   float call_frequency_;
 
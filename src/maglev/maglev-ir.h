@@ -4565,6 +4565,14 @@ class AllocateRaw : public FixedInputValueNodeT<0, AllocateRaw> {
   AllocationType allocation_type() const { return allocation_type_; }
   int size() const { return size_; }
 
+  // Allow pretenuring young allocations that are stored into old ones, see
+  // MaglevGraphBuilder::PropagatePretenuring.
+  void set_allocation_type(AllocationType allocation_type) {
+    DCHECK_EQ(allocation_type_, AllocationType::kYoung);
+    DCHECK_EQ(allocation_type, AllocationType::kOld);
+    allocation_type_ = allocation_type;
+  }
+
   // Allow increasing the size for allocation folding.
   void extend(int size) {
     DCHECK_GT(size, 0);
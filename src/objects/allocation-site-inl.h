@@ -159,6 +159,26 @@ void AllocationSite::set_deopt_dependent_code(bool deopt) {
                      kRelaxedStore);
 }
 
+int AllocationSite::tenure_history() const {
+  return TenureHistoryBits::decode(pretenure_data(kRelaxedLoad));
+}
+
+void AllocationSite::set_tenure_history(int history) {
+  int32_t value = pretenure_data(kRelaxedLoad);
+  set_pretenure_data(TenureHistoryBits::update(value, history), kRelaxedStore);
+}
+
+int AllocationSite::tenure_age() const {
+  DCHECK_EQ(kTenure, pretenure_decision());
+  return MementoFoundCountBits::decode(pretenure_data(kRelaxedLoad));
+}
+
+void AllocationSite::set_tenure_age(int age) {
+  DCHECK_EQ(kTenure, pretenure_decision());
+  int32_t value = pretenure_data(kRelaxedLoad);
+  set_pretenure_data(MementoFoundCountBits::update(value, age), kRelaxedStore);
+}
+
 int AllocationSite::memento_found_count() const {
   return MementoFoundCountBits::decode(pretenure_data(kRelaxedLoad));
 }
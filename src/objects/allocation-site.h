@@ -76,6 +76,9 @@ class AllocationSite : public Struct {
   using MementoFoundCountBits = base::BitField<int, 0, 26>;
   using PretenureDecisionBits = base::BitField<PretenureDecision, 26, 3>;
   using DeoptDependentCodeBit = base::BitField<bool, 29, 1>;
+  // How many times in a row the site was pretenured again after its tenure
+  // decision decayed, see --allocation-site-pretenuring-decay.
+  using TenureHistoryBits = base::BitField<int, 30, 2>;
   static_assert(PretenureDecisionBits::kMax >= kLastPretenureDecisionValue);
 
   // Increments the mementos found counter and returns the new count.
@@ -93,6 +96,15 @@ class AllocationSite : public Struct {
   inline bool deopt_dependent_code() const;
   inline void set_deopt_dependent_code(bool deopt);
 
+  inline int tenure_history() const;
+  inline void set_tenure_history(int history);
+
+  // With --allocation-site-pretenuring-decay, tenured sites don't collect
+  // memento feedback. Their memento found count holds the number of full GCs
+  // that their tenure decision survived instead.
+  inline int tenure_age() const;
+  inline void set_tenure_age(int age);
+
   inline int memento_found_count() const;
   inline void set_memento_found_count(int count);
 
@@ -66,6 +66,16 @@ class JSFinalizationRegistry
       Isolate* isolate, Address raw_finalization_registry,
       Address raw_weak_cell);
 
+  // Pops the first WeakCell off the cleared_cells list like the
+  // FinalizationRegistryCleanupLoop builtin, and returns its holdings. Does not
+  // shrink the key map; call ShrinkUnregisterTokenMap when done popping.
+  // Requires NeedsCleanup().
+  static Handle<Object> PopClearedCellHoldings(
+      Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate);
+
+  static void ShrinkUnregisterTokenMap(
+      Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate);
+
   // Bitfields in flags.
   DEFINE_TORQUE_GENERATED_FINALIZATION_REGISTRY_FLAGS()
 
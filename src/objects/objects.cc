@@ -6428,6 +6428,43 @@ void JSFinalizationRegistry::RemoveCellFromUnregisterTokenMap(
   weak_cell->set_key_list_next(undefined);
 }
 
+// static
+Handle<Object> JSFinalizationRegistry::PopClearedCellHoldings(
+    Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(finalization_registry->NeedsCleanup());
+  Tagged<HeapObject> undefined = ReadOnlyRoots(isolate).undefined_value();
+  Tagged<WeakCell> weak_cell =
+      WeakCell::cast(finalization_registry->cleared_cells());
+  DCHECK(IsUndefined(weak_cell->prev(), isolate));
+
+  // Split off the tail of the cleared_cells list.
+  finalization_registry->set_cleared_cells(weak_cell->next());
+  weak_cell->set_next(undefined);
+  if (IsWeakCell(finalization_registry->cleared_cells())) {
+    Tagged<WeakCell> new_head =
+        WeakCell::cast(finalization_registry->cleared_cells());
+    DCHECK_EQ(new_head->prev(), weak_cell);
+    new_head->set_prev(undefined);
+  }
+
+  if (!IsUndefined(weak_cell->unregister_token(), isolate)) {
+    RemoveCellFromUnregisterTokenMap(isolate, finalization_registry->ptr(),
+                                     weak_cell.ptr());
+  }
+  return handle(weak_cell->holdings(), isolate);
+}
+
+// static
+void JSFinalizationRegistry::ShrinkUnregisterTokenMap(
+    Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate) {
+  if (IsUndefined(finalization_registry->key_map(), isolate)) return;
+  Handle<SimpleNumberDictionary> key_map = handle(
+      SimpleNumberDictionary::cast(finalization_registry->key_map()), isolate);
+  key_map = SimpleNumberDictionary::Shrink(isolate, key_map);
+  finalization_registry->set_key_map(*key_map);
+}
+
 // static
 bool MapWord::IsMapOrForwarded(Tagged<Map> map) {
   MapWord map_word = map->map_word(kRelaxedLoad);
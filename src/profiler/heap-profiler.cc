@@ -15,8 +15,10 @@
 #include "src/heap/heap.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/profiler/allocation-tracker.h"
+#include "src/profiler/heap-retention-summary.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/sampling-heap-profiler.h"
+#include "src/tasks/cancelable-task.h"
 
 namespace v8 {
 namespace internal {
@@ -119,6 +121,102 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+namespace {
+
+class DeliverRetentionSummaryTask final : public CancelableTask {
+ public:
+  DeliverRetentionSummaryTask(Isolate* isolate,
+                              std::unique_ptr<RetentionSummary> summary,
+                              RetentionSummaryCallback callback, void* data)
+      : CancelableTask(isolate),
+        summary_(std::move(summary)),
+        callback_(callback),
+        data_(data) {}
+
+ private:
+  void RunInternal() final { callback_(std::move(summary_), data_); }
+
+  std::unique_ptr<RetentionSummary> summary_;
+  RetentionSummaryCallback callback_;
+  void* data_;
+};
+
+// Computes the summary on a worker thread and posts it back to the isolate.
+class RetentionSummaryTask final : public CancelableTask {
+ public:
+  RetentionSummaryTask(Isolate* isolate, std::unique_ptr<RetentionGraph> graph,
+                       const RetentionSummaryOptions& options,
+                       RetentionSummaryCallback callback, void* data)
+      : CancelableTask(isolate),
+        isolate_(isolate),
+        task_runner_(isolate->heap()->GetForegroundTaskRunner()),
+        graph_(std::move(graph)),
+        max_classes_(options.max_classes),
+        max_retaining_path_length_(options.max_retaining_path_length),
+        callback_(callback),
+        data_(data) {}
+
+ private:
+  void RunInternal() final {
+    auto summary =
+        graph_->Summarize(max_classes_, max_retaining_path_length_);
+    graph_.reset();
+    task_runner_->PostTask(std::make_unique<DeliverRetentionSummaryTask>(
+        isolate_, std::move(summary), callback_, data_));
+  }
+
+  Isolate* const isolate_;
+  const std::shared_ptr<v8::TaskRunner> task_runner_;
+  std::unique_ptr<RetentionGraph> graph_;
+  const size_t max_classes_;
+  const size_t max_retaining_path_length_;
+  const RetentionSummaryCallback callback_;
+  void* const data_;
+};
+
+}  // namespace
+
+void HeapProfiler::TakeRetentionSummary(const RetentionSummaryOptions& options,
+                                        RetentionSummaryCallback callback,
+                                        void* data) {
+  is_taking_snapshot_ = true;
+  std::unique_ptr<RetentionGraph> graph;
+  {
+    // The snapshot is only used for walking the heaps, and is neither kept nor
+    // exposed. Its entries and edges are copied into the graph, without ever
+    // sorting the edges into children, and its strings are copied as well.
+    HeapSnapshot snapshot(this, options.snapshot_mode,
+                          v8::HeapProfiler::NumericsMode::kHideNumericValues);
+    heap()->stack().SetMarkerIfNeededAndCallback(
+        [this, &options, &snapshot, &graph]() {
+          base::Optional<CppClassNamesAsHeapObjectNameScope> use_cpp_class_name;
+          if (snapshot.expose_internals() && heap()->cpp_heap()) {
+            use_cpp_class_name.emplace(heap()->cpp_heap());
+          }
+
+          HeapSnapshotGenerator generator(&snapshot, nullptr, nullptr, heap(),
+                                          options.stack_state);
+          generator.set_fill_children(false);
+          // Without an ActivityControl, generation cannot be aborted.
+          CHECK(generator.GenerateSnapshot());
+          graph = std::make_unique<RetentionGraph>(&snapshot);
+        });
+  }
+  if (is_tracking_object_moves_) {
+    ids_->RemoveDeadEntries();
+  } else {
+    // Object ids are not exposed, and would go stale without tracking moves.
+    ids_.reset(new HeapObjectsMap(heap()));
+  }
+  is_taking_snapshot_ = false;
+  MaybeClearStringsStorage();
+
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      std::make_unique<RetentionSummaryTask>(heap()->isolate(),
+                                             std::move(graph), options,
+                                             callback, data));
+}
+
 class FileOutputStream : public v8::OutputStream {
  public:
   explicit FileOutputStream(const char* filename) : os_(filename) {}
@@ -13,6 +13,7 @@
 #include "src/common/globals.h"
 #include "src/debug/debug-interface.h"
 #include "src/heap/heap.h"
+#include "src/profiler/heap-retention-summary.h"
 
 namespace v8 {
 namespace internal {
@@ -60,6 +61,13 @@ class HeapProfiler : public HeapObjectAllocationTracker {
 
   HeapSnapshot* TakeSnapshot(
       const v8::HeapProfiler::HeapSnapshotOptions options);
+  // Computes a RetentionSummary without keeping a heap snapshot. The object
+  // graph is recorded on the calling thread like for TakeSnapshot(), and then
+  // copied into a compact form. Dominators and retained sizes are computed on
+  // a worker thread, and |callback| is invoked from a task on the isolate's
+  // foreground task runner, unless the isolate is disposed before.
+  void TakeRetentionSummary(const RetentionSummaryOptions& options,
+                            RetentionSummaryCallback callback, void* data);
 
   // Implementation of --heap-snapshot-on-oom.
   void WriteSnapshotToDiskAfterGC();
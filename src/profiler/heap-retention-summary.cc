@@ -0,0 +1,320 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/heap-retention-summary.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "src/profiler/heap-snapshot-generator-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr uint32_t kRootNode = 0;
+constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+
+// Objects are grouped like in the summary view of DevTools: objects by their
+// names, everything else by category.
+const char* ClassName(const HeapEntry& entry) {
+  switch (entry.type()) {
+    case HeapEntry::kObject:
+    case HeapEntry::kNative:
+    case HeapEntry::kSynthetic:
+      return entry.name();
+    case HeapEntry::kHidden:
+      return "(system)";
+    case HeapEntry::kArray:
+      return "(array)";
+    case HeapEntry::kString:
+    case HeapEntry::kConsString:
+    case HeapEntry::kSlicedString:
+      return "(string)";
+    case HeapEntry::kCode:
+      return "(compiled code)";
+    case HeapEntry::kClosure:
+      return "(closure)";
+    case HeapEntry::kRegExp:
+      return "(regexp)";
+    case HeapEntry::kHeapNumber:
+      return "(number)";
+    case HeapEntry::kSymbol:
+      return "(symbol)";
+    case HeapEntry::kBigInt:
+      return "(bigint)";
+    case HeapEntry::kObjectShape:
+      return "(object shape)";
+    case HeapEntry::kNumTypes:
+      UNREACHABLE();
+  }
+}
+
+// Like isEssentialEdge() in DevTools: weak edges don't retain anything, and
+// shortcut edges only retain the objects they point to from the root, e.g.
+// the global objects. Elsewhere, they are just shortcuts for paths that also
+// exist in the graph.
+bool IsEssentialEdge(const HeapGraphEdge& edge) {
+  switch (edge.type()) {
+    case HeapGraphEdge::kWeak:
+      return false;
+    case HeapGraphEdge::kShortcut:
+      return edge.from_index() == static_cast<int>(kRootNode);
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+RetentionGraph::RetentionGraph(HeapSnapshot* snapshot) {
+  DCHECK_EQ(kRootNode, snapshot->root()->index());
+  DCHECK(!snapshot->is_complete());
+  const std::deque<HeapEntry>& entries = snapshot->entries();
+  std::deque<HeapGraphEdge>& edges = snapshot->edges();
+  self_sizes_.reserve(entries.size());
+  class_ids_.reserve(entries.size());
+  first_edge_.resize(entries.size() + 1);
+
+  // Names are interned in the profiler's StringsStorage, so classes can be
+  // looked up by address. Native objects get separate classes, as C++ class
+  // names may coincide with JS constructor names.
+  std::unordered_map<const char*, uint32_t> class_ids[2];
+  for (const HeapEntry& entry : entries) {
+    const bool is_native = entry.type() == HeapEntry::kNative;
+    const char* name = ClassName(entry);
+    auto it = class_ids[is_native].find(name);
+    if (it == class_ids[is_native].end()) {
+      it = class_ids[is_native]
+               .emplace(name, static_cast<uint32_t>(classes_.size()))
+               .first;
+      classes_.push_back(
+          {name, is_native, entry.type() == HeapEntry::kSynthetic});
+    }
+    self_sizes_.push_back(entry.self_size());
+    class_ids_.push_back(it->second);
+  }
+
+  // The edges are grouped by node like HeapSnapshot::FillChildren() does, but
+  // directly into the compact form, and the snapshot's edges are released
+  // while they are copied. This keeps the memory use below that of a complete
+  // snapshot.
+  for (const HeapGraphEdge& edge : edges) {
+    if (!IsEssentialEdge(edge)) continue;
+    ++first_edge_[edge.from_index() + 1];
+  }
+  for (size_t i = 1; i < first_edge_.size(); ++i) {
+    first_edge_[i] += first_edge_[i - 1];
+  }
+  edges_.resize(first_edge_.back());
+  std::vector<uint32_t> next_edge(first_edge_.begin(), first_edge_.end() - 1);
+  while (!edges.empty()) {
+    const HeapGraphEdge& edge = edges.front();
+    if (IsEssentialEdge(edge)) {
+      edges_[next_edge[edge.from_index()]++] =
+          static_cast<uint32_t>(edge.to()->index());
+    }
+    edges.pop_front();
+  }
+}
+
+std::unique_ptr<RetentionSummary> RetentionGraph::Summarize(
+    size_t max_classes, size_t max_retaining_path_length) const {
+  auto summary = std::make_unique<RetentionSummary>();
+  if (node_count() == 0) return summary;
+
+  // Number the reachable nodes in depth-first postorder. Dominators are
+  // ancestors in the depth-first tree, and thus always have higher numbers.
+  // The computations below use these numbers instead of node ids.
+  std::vector<uint32_t> postorder;
+  std::vector<uint32_t> postorder_number(node_count(), kNoNode);
+  {
+    std::vector<bool> visited(node_count(), false);
+    // Pairs of nodes and their next edge to visit.
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    stack.emplace_back(kRootNode, first_edge_[kRootNode]);
+    visited[kRootNode] = true;
+    while (!stack.empty()) {
+      const uint32_t node = stack.back().first;
+      const uint32_t edge = stack.back().second;
+      if (edge < first_edge_[node + 1]) {
+        stack.back().second++;
+        const uint32_t target = edges_[edge];
+        if (!visited[target]) {
+          visited[target] = true;
+          stack.emplace_back(target, first_edge_[target]);
+        }
+        continue;
+      }
+      postorder_number[node] = static_cast<uint32_t>(postorder.size());
+      postorder.push_back(node);
+      stack.pop_back();
+    }
+  }
+  const uint32_t reachable_count = static_cast<uint32_t>(postorder.size());
+  const uint32_t root = reachable_count - 1;
+
+  // Predecessors of the reachable nodes.
+  std::vector<uint32_t> first_predecessor(reachable_count + 1, 0);
+  std::vector<uint32_t> predecessors;
+  for (uint32_t node : postorder) {
+    for (uint32_t edge = first_edge_[node]; edge < first_edge_[node + 1];
+         ++edge) {
+      first_predecessor[postorder_number[edges_[edge]] + 1]++;
+    }
+  }
+  for (uint32_t i = 0; i < reachable_count; ++i) {
+    first_predecessor[i + 1] += first_predecessor[i];
+  }
+  predecessors.resize(first_predecessor[reachable_count]);
+  {
+    std::vector<uint32_t> next_predecessor(first_predecessor.begin(),
+                                           first_predecessor.end() - 1);
+    for (uint32_t source = 0; source < reachable_count; ++source) {
+      const uint32_t node = postorder[source];
+      for (uint32_t edge = first_edge_[node]; edge < first_edge_[node + 1];
+           ++edge) {
+        predecessors[next_predecessor[postorder_number[edges_[edge]]]++] =
+            source;
+      }
+    }
+  }
+
+  // Immediate dominators, computed with the iterative algorithm from "A
+  // Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy.
+  std::vector<uint32_t> dominator(reachable_count, kNoNode);
+  dominator[root] = root;
+  auto intersect = [&dominator](uint32_t a, uint32_t b) {
+    while (a != b) {
+      while (a < b) a = dominator[a];
+      while (b < a) b = dominator[b];
+    }
+    return a;
+  };
+  for (bool changed = true; changed;) {
+    changed = false;
+    // Reverse postorder, so that at least the parent in the depth-first tree
+    // has been visited.
+    for (uint32_t node = root; node-- > 0;) {
+      uint32_t new_dominator = kNoNode;
+      for (uint32_t i = first_predecessor[node]; i < first_predecessor[node + 1];
+           ++i) {
+        const uint32_t predecessor = predecessors[i];
+        if (dominator[predecessor] == kNoNode) continue;
+        new_dominator = new_dominator == kNoNode
+                            ? predecessor
+                            : intersect(predecessor, new_dominator);
+      }
+      DCHECK_NE(kNoNode, new_dominator);
+      if (dominator[node] != new_dominator) {
+        dominator[node] = new_dominator;
+        changed = true;
+      }
+    }
+  }
+
+  std::vector<size_t> retained_size(reachable_count);
+  for (uint32_t node = 0; node < reachable_count; ++node) {
+    retained_size[node] = self_sizes_[postorder[node]];
+  }
+  for (uint32_t node = 0; node < root; ++node) {
+    retained_size[dominator[node]] += retained_size[node];
+  }
+  summary->total_size = retained_size[root];
+
+  // Objects of a class that are dominated by other objects of the same class
+  // must not be counted twice for the retained size of the class. Walk the
+  // dominator tree and only count the outermost objects of each class.
+  std::vector<uint32_t> first_dominated(reachable_count + 1, 0);
+  std::vector<uint32_t> dominated(root);
+  for (uint32_t node = 0; node < root; ++node) {
+    first_dominated[dominator[node] + 1]++;
+  }
+  for (uint32_t i = 0; i < reachable_count; ++i) {
+    first_dominated[i + 1] += first_dominated[i];
+  }
+  {
+    std::vector<uint32_t> next_dominated(first_dominated.begin(),
+                                         first_dominated.end() - 1);
+    for (uint32_t node = 0; node < root; ++node) {
+      dominated[next_dominated[dominator[node]]++] = node;
+    }
+  }
+
+  struct ClassStats {
+    size_t count = 0;
+    size_t self_size = 0;
+    size_t retained_size = 0;
+    uint32_t largest_instance = kNoNode;
+    // Number of instances among the dominators of the current node.
+    uint32_t active_instances = 0;
+  };
+  std::vector<ClassStats> stats(classes_.size());
+  {
+    // Pairs of nodes and their next dominated node to visit.
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    stack.emplace_back(root, first_dominated[root]);
+    while (!stack.empty()) {
+      const uint32_t node = stack.back().first;
+      const uint32_t next = stack.back().second;
+      ClassStats& node_stats = stats[class_ids_[postorder[node]]];
+      if (next == first_dominated[node]) {
+        // Entering |node|.
+        node_stats.count++;
+        node_stats.self_size += self_sizes_[postorder[node]];
+        if (node_stats.active_instances == 0) {
+          node_stats.retained_size += retained_size[node];
+        }
+        if (node_stats.largest_instance == kNoNode ||
+            retained_size[node] > retained_size[node_stats.largest_instance]) {
+          node_stats.largest_instance = node;
+        }
+        node_stats.active_instances++;
+      }
+      if (next < first_dominated[node + 1]) {
+        stack.back().second++;
+        stack.emplace_back(dominated[next], first_dominated[dominated[next]]);
+        continue;
+      }
+      node_stats.active_instances--;
+      stack.pop_back();
+    }
+  }
+
+  std::vector<uint32_t> class_order;
+  for (uint32_t class_id = 0; class_id < classes_.size(); ++class_id) {
+    if (stats[class_id].count == 0 || classes_[class_id].is_synthetic) continue;
+    class_order.push_back(class_id);
+  }
+  const size_t class_count = std::min(max_classes, class_order.size());
+  std::partial_sort(class_order.begin(), class_order.begin() + class_count,
+                    class_order.end(), [&stats](uint32_t a, uint32_t b) {
+                      return stats[a].retained_size > stats[b].retained_size;
+                    });
+  summary->classes.reserve(class_count);
+  for (size_t i = 0; i < class_count; ++i) {
+    const ClassInfo& info = classes_[class_order[i]];
+    const ClassStats& class_stats = stats[class_order[i]];
+    RetentionSummary::Class& entry = summary->classes.emplace_back();
+    entry.name = info.name;
+    entry.is_native = info.is_native;
+    entry.count = class_stats.count;
+    entry.self_size = class_stats.self_size;
+    entry.retained_size = class_stats.retained_size;
+    for (uint32_t node = dominator[class_stats.largest_instance];
+         node != root &&
+         entry.retaining_path.size() < max_retaining_path_length;
+         node = dominator[node]) {
+      entry.retaining_path.push_back(
+          classes_[class_ids_[postorder[node]]].name);
+    }
+  }
+  return summary;
+}
+
+}  // namespace internal
+}  // namespace v8
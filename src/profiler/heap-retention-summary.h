@@ -0,0 +1,104 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_HEAP_RETENTION_SUMMARY_H_
+#define V8_PROFILER_HEAP_RETENTION_SUMMARY_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/cppgc/common.h"
+#include "include/v8-profiler.h"
+
+namespace v8 {
+namespace internal {
+
+class HeapSnapshot;
+
+// A summary of what retains memory in the V8 heap and in the attached
+// CppHeap, if any. See HeapProfiler::TakeRetentionSummary().
+//
+// This is not exposed in the API: the object graph is still recorded by the
+// HeapSnapshotGenerator on the main thread, which costs as much as taking a
+// heap snapshot, and is thus too expensive to run periodically in production.
+struct RetentionSummary final {
+  struct Class final {
+    // The constructor name of JS objects, the class name of embedder objects,
+    // or a category in parentheses, e.g. "(string)".
+    std::string name;
+    // Whether the objects are embedder objects, e.g. of the CppHeap.
+    bool is_native = false;
+    size_t count = 0;
+    size_t self_size = 0;
+    // The size of all objects that are only reachable through objects of this
+    // class, including the objects themselves.
+    size_t retained_size = 0;
+    // The class names of the dominators of the instance with the largest
+    // retained size, starting with its immediate dominator. Every path from
+    // the roots to that instance passes through all of them.
+    std::vector<std::string> retaining_path;
+  };
+
+  // The size of all reachable objects.
+  size_t total_size = 0;
+  // The classes with the largest retained sizes, in descending order.
+  std::vector<Class> classes;
+};
+
+struct RetentionSummaryOptions final {
+  v8::HeapProfiler::HeapSnapshotMode snapshot_mode =
+      v8::HeapProfiler::HeapSnapshotMode::kRegular;
+  cppgc::EmbedderStackState stack_state =
+      cppgc::EmbedderStackState::kMayContainHeapPointers;
+  // The maximum number of classes in the summary.
+  size_t max_classes = 32;
+  // The maximum length of RetentionSummary::Class::retaining_path.
+  size_t max_retaining_path_length = 8;
+};
+
+using RetentionSummaryCallback =
+    void (*)(std::unique_ptr<RetentionSummary> summary, void* data);
+
+// A compact copy of the object graph of a heap snapshot, holding just enough
+// to compute a RetentionSummary. The snapshot can be released right after the
+// copy is taken, and the summary can be computed on any thread.
+class RetentionGraph final {
+ public:
+  // Takes the edges of |snapshot|, which must have been generated without
+  // filling the children of its entries.
+  explicit RetentionGraph(HeapSnapshot* snapshot);
+  RetentionGraph(const RetentionGraph&) = delete;
+  RetentionGraph& operator=(const RetentionGraph&) = delete;
+
+  // Computes the dominator tree of the graph and aggregates the retained sizes
+  // by class.
+  std::unique_ptr<RetentionSummary> Summarize(
+      size_t max_classes, size_t max_retaining_path_length) const;
+
+  size_t node_count() const { return self_sizes_.size(); }
+
+ private:
+  struct ClassInfo {
+    std::string name;
+    bool is_native;
+    // Synthetic nodes, e.g. "(GC roots)", only show up in retaining paths.
+    bool is_synthetic;
+  };
+
+  // Nodes are numbered like the entries of the snapshot. The root is node 0.
+  // Outgoing edges of node i are |edges_[first_edge_[i]..first_edge_[i+1])|.
+  // Like in DevTools, weak edges and shortcut edges from nodes other than the
+  // root are dropped, as they don't retain anything.
+  std::vector<size_t> self_sizes_;
+  std::vector<uint32_t> class_ids_;
+  std::vector<uint32_t> first_edge_;
+  std::vector<uint32_t> edges_;
+  std::vector<ClassInfo> classes_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_HEAP_RETENTION_SUMMARY_H_
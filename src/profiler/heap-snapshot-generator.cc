@@ -4,8 +4,12 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <atomic>
+#include <functional>
+#include <string>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
 #include "src/base/vector.h"
@@ -17,6 +21,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -3016,7 +3021,7 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  if (fill_children_) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -3040,7 +3045,7 @@ bool HeapSnapshotGenerator::GenerateSnapshotAfterGC() {
       std::move(temporary_global_object_tags));
   snapshot_->AddSyntheticRootEntries();
   if (!FillReferences()) return false;
-  snapshot_->FillChildren();
+  if (fill_children_) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
   return true;
 }
@@ -3155,8 +3160,52 @@ int HeapSnapshotJSONSerializer::GetStringId(const char* s) {
   return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
 }
 
+int HeapSnapshotJSONSerializer::LookupStringId(const char* s) const {
+  base::HashMap::Entry* cache_entry =
+      strings_.Lookup(const_cast<char*>(s), StringHash(s));
+  DCHECK_NOT_NULL(cache_entry);
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
 namespace {
 
+// The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
+constexpr int kEdgeBufferSize =
+    MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
+
+// The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
+// \n and \0
+constexpr int kNodeBufferSize =
+    5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
+
+// Formats chunks of nodes or edges for HeapSnapshotJSONSerializer on worker
+// threads.
+class FormatChunksJob final : public v8::JobTask {
+ public:
+  FormatChunksJob(size_t chunks, std::function<void(size_t)> format_chunk)
+      : chunks_(chunks), format_chunk_(std::move(format_chunk)) {}
+
+  void Run(JobDelegate* delegate) override {
+    for (size_t chunk = next_chunk_++; chunk < chunks_;
+         chunk = next_chunk_++) {
+      format_chunk_(chunk);
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk < chunks_ ? chunks_ - next_chunk : 0;
+  }
+
+ private:
+  const size_t chunks_;
+  const std::function<void(size_t)> format_chunk_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
 template <size_t size>
 struct ToUnsigned;
 
@@ -3203,32 +3252,92 @@ static int utoa(T value, base::Vector<char> buffer, int buffer_pos) {
   return utoa_impl(unsigned_value, buffer, buffer_pos);
 }
 
-void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
-                                               bool first_edge) {
-  // The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
-  static const int kBufferSize =
-      MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
-  base::EmbeddedVector<char, kBufferSize> buffer;
-  int edge_name_or_index = edge->type() == HeapGraphEdge::kElement ||
-                                   edge->type() == HeapGraphEdge::kHidden
-                               ? edge->index()
-                               : GetStringId(edge->name());
+static bool HasIndex(HeapGraphEdge* edge) {
+  return edge->type() == HeapGraphEdge::kElement ||
+         edge->type() == HeapGraphEdge::kHidden;
+}
+
+template <typename FormatItem>
+void HeapSnapshotJSONSerializer::SerializeInParallel(size_t count,
+                                                     FormatItem format_item) {
+  static constexpr size_t kItemsPerChunk = 16 * KB;
+  // Formatted chunks are a few hundred KB each, so this bounds the memory
+  // used for chunks that are not yet written to a few MB per thread.
+  const size_t chunks_per_batch =
+      4 * (V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+  std::vector<std::string> chunks(chunks_per_batch);
+  for (size_t batch_start = 0; batch_start < count;
+       batch_start += chunks_per_batch * kItemsPerChunk) {
+    size_t batch_chunks =
+        std::min(chunks_per_batch,
+                 (count - batch_start + kItemsPerChunk - 1) / kItemsPerChunk);
+    auto format_chunk = [&chunks, &format_item, batch_start,
+                         count](size_t chunk) {
+      std::string& out = chunks[chunk];
+      out.clear();
+      size_t start = batch_start + chunk * kItemsPerChunk;
+      size_t end = std::min(count, start + kItemsPerChunk);
+      for (size_t i = start; i < end; ++i) format_item(i, &out);
+    };
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<FormatChunksJob>(batch_chunks,
+                                                      std::move(format_chunk)))
+        ->Join();
+    for (size_t chunk = 0; chunk < batch_chunks; ++chunk) {
+      writer_->AddSubstring(chunks[chunk].c_str(),
+                            static_cast<int>(chunks[chunk].size()));
+      if (writer_->aborted()) return;
+    }
+  }
+}
+
+int HeapSnapshotJSONSerializer::FormatEdge(HeapGraphEdge* edge,
+                                           bool first_edge, int name_or_index,
+                                           base::Vector<char> buffer) {
   int buffer_pos = 0;
   if (!first_edge) {
     buffer[buffer_pos++] = ',';
   }
   buffer_pos = utoa(edge->type(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(edge_name_or_index, buffer, buffer_pos);
+  buffer_pos = utoa(name_or_index, buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(to_node_index(edge->to()), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  return buffer_pos;
+}
+
+void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
+                                               bool first_edge) {
+  base::EmbeddedVector<char, kEdgeBufferSize> buffer;
+  int name_or_index =
+      HasIndex(edge) ? edge->index() : GetStringId(edge->name());
+  int length = FormatEdge(edge, first_edge, name_or_index, buffer);
+  writer_->AddSubstring(buffer.begin(), length);
 }
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
   std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  if (v8_flags.heap_snapshot_parallel_serialization) {
+    // Assigning the string ids up front makes them the same as in the
+    // sequential serialization, and leaves |strings_| read-only for the
+    // formatting tasks.
+    for (HeapGraphEdge* edge : edges) {
+      if (!HasIndex(edge)) GetStringId(edge->name());
+    }
+    SerializeInParallel(edges.size(), [this, &edges](size_t i,
+                                                     std::string* out) {
+      base::EmbeddedVector<char, kEdgeBufferSize> buffer;
+      HeapGraphEdge* edge = edges[i];
+      int name_or_index =
+          HasIndex(edge) ? edge->index() : LookupStringId(edge->name());
+      int length = FormatEdge(edge, i == 0, name_or_index, buffer);
+      out->append(buffer.begin(), length);
+    });
+    return;
+  }
   for (size_t i = 0; i < edges.size(); ++i) {
     DCHECK(i == 0 ||
            edges[i - 1]->from()->index() <= edges[i]->from()->index());
@@ -3237,21 +3346,16 @@ void HeapSnapshotJSONSerializer::SerializeEdges() {
   }
 }
 
-void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
-  // The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
-  // \n and \0
-  static const int kBufferSize =
-      5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
-  base::EmbeddedVector<char, kBufferSize> buffer;
+int HeapSnapshotJSONSerializer::FormatNode(const HeapEntry* entry,
+                                           int name_id,
+                                           base::Vector<char> buffer) {
   int buffer_pos = 0;
   if (to_node_index(entry) != 0) {
     buffer[buffer_pos++] = ',';
   }
   buffer_pos = utoa(entry->type(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(GetStringId(entry->name()), buffer, buffer_pos);
+  buffer_pos = utoa(name_id, buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->id(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
@@ -3263,12 +3367,29 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->detachedness(), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  return buffer_pos;
+}
+
+void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
+  base::EmbeddedVector<char, kNodeBufferSize> buffer;
+  int length = FormatNode(entry, GetStringId(entry->name()), buffer);
+  writer_->AddSubstring(buffer.begin(), length);
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
   const std::deque<HeapEntry>& entries = snapshot_->entries();
+  if (v8_flags.heap_snapshot_parallel_serialization) {
+    for (const HeapEntry& entry : entries) GetStringId(entry.name());
+    SerializeInParallel(entries.size(), [this, &entries](size_t i,
+                                                         std::string* out) {
+      base::EmbeddedVector<char, kNodeBufferSize> buffer;
+      const HeapEntry* entry = &entries[i];
+      int length = FormatNode(entry, LookupStringId(entry->name()), buffer);
+      out->append(buffer.begin(), length);
+    });
+    return;
+  }
   for (const HeapEntry& entry : entries) {
     SerializeNode(&entry);
     if (writer_->aborted()) return;
@@ -3578,5 +3699,163 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+namespace {
+
+// Collects the varints of one node, edge or location, and writes them to the
+// stream at once.
+class VarintBuffer {
+ public:
+  void Add(uint64_t value) {
+    do {
+      DCHECK_LT(length_, kMaxLength);
+      uint8_t byte = value & 0x7F;
+      value >>= 7;
+      bytes_[length_++] = value == 0 ? byte : byte | 0x80;
+    } while (value != 0);
+  }
+
+  void AddZigZag(int64_t value) {
+    Add((static_cast<uint64_t>(value) << 1) ^
+        static_cast<uint64_t>(value >> 63));
+  }
+
+  void WriteTo(OutputStreamWriter* writer) {
+    writer->AddBytes(bytes_, length_);
+    length_ = 0;
+  }
+
+ private:
+  // Enough for the 7 fields of a node.
+  static constexpr int kMaxLength = 7 * 10;
+  uint8_t bytes_[kMaxLength];
+  int length_ = 0;
+};
+
+}  // namespace
+
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+
+  if (i::v8_flags.profile_heap_snapshot) {
+    base::OS::PrintError(
+        "[Binary serialization of heap snapshot took %0.3f ms]\n",
+        timer.Elapsed().InMillisecondsF());
+  }
+  timer.Stop();
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto result =
+      string_ids_.emplace(s, static_cast<uint32_t>(strings_.size()));
+  if (result.second) strings_.push_back(s);
+  return result.first->second;
+}
+
+void HeapSnapshotBinarySerializer::SerializeImpl() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  // The string table comes first, so that readers can resolve names while
+  // reading the nodes and edges. Assign the ids in the same order in which
+  // the nodes and edges are written.
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    GetStringId(entry.name());
+  }
+  for (HeapGraphEdge* edge : snapshot_->children()) {
+    if (edge->type() != HeapGraphEdge::kElement &&
+        edge->type() != HeapGraphEdge::kHidden) {
+      GetStringId(edge->name());
+    }
+  }
+
+  writer_->AddBytes(reinterpret_cast<const uint8_t*>(kMagic),
+                    static_cast<int>(strlen(kMagic)));
+  VarintBuffer buffer;
+  buffer.Add(kVersion);
+  buffer.WriteTo(writer_);
+  SerializeStrings();
+  if (writer_->aborted()) return;
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  SerializeEdges();
+  if (writer_->aborted()) return;
+  SerializeLocations();
+  if (writer_->aborted()) return;
+  writer_->Finalize();
+}
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  VarintBuffer buffer;
+  buffer.Add(strings_.size());
+  buffer.WriteTo(writer_);
+  for (const char* s : strings_) {
+    size_t length = strlen(s);
+    DCHECK_GE(kMaxInt, length);
+    buffer.Add(length);
+    buffer.WriteTo(writer_);
+    writer_->AddBytes(reinterpret_cast<const uint8_t*>(s),
+                      static_cast<int>(length));
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodes() {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  VarintBuffer buffer;
+  buffer.Add(entries.size());
+  buffer.WriteTo(writer_);
+  SnapshotObjectId previous_id = 0;
+  for (const HeapEntry& entry : entries) {
+    buffer.Add(entry.type());
+    buffer.Add(string_ids_.at(entry.name()));
+    buffer.AddZigZag(static_cast<int64_t>(entry.id()) - previous_id);
+    previous_id = entry.id();
+    buffer.Add(entry.self_size());
+    buffer.Add(entry.children_count());
+    buffer.Add(entry.trace_node_id());
+    buffer.Add(entry.detachedness());
+    buffer.WriteTo(writer_);
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdges() {
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  VarintBuffer buffer;
+  buffer.Add(edges.size());
+  buffer.WriteTo(writer_);
+  for (HeapGraphEdge* edge : edges) {
+    buffer.Add(edge->type());
+    if (edge->type() == HeapGraphEdge::kElement ||
+        edge->type() == HeapGraphEdge::kHidden) {
+      buffer.Add(static_cast<uint32_t>(edge->index()));
+    } else {
+      buffer.Add(string_ids_.at(edge->name()));
+    }
+    buffer.Add(static_cast<uint32_t>(edge->to()->index()));
+    buffer.WriteTo(writer_);
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeLocations() {
+  const std::vector<SourceLocation>& locations = snapshot_->locations();
+  VarintBuffer buffer;
+  buffer.Add(locations.size());
+  buffer.WriteTo(writer_);
+  for (const SourceLocation& location : locations) {
+    buffer.Add(static_cast<uint32_t>(location.entry_index));
+    buffer.Add(static_cast<uint32_t>(location.scriptId));
+    buffer.Add(static_cast<uint32_t>(location.line));
+    buffer.Add(static_cast<uint32_t>(location.col));
+    buffer.WriteTo(writer_);
+    if (writer_->aborted()) return;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
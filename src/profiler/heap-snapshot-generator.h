@@ -683,6 +683,11 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
 
   Heap* heap() const { return heap_; }
 
+  // Without filling the children, the snapshot is left incomplete, with the
+  // edges only in HeapSnapshot::edges(). This is for consumers that copy the
+  // graph into their own representation.
+  void set_fill_children(bool fill_children) { fill_children_ = fill_children; }
+
  private:
   bool FillReferences();
   void ProgressStep() override;
@@ -701,6 +706,7 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   uint32_t progress_total_;
   Heap* heap_;
   cppgc::EmbedderStackState stack_state_;
+  bool fill_children_ = true;
 
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
   std::unordered_map<HeapEntry*, HeapThing> reverse_entries_map_;
@@ -732,13 +738,25 @@ class HeapSnapshotJSONSerializer {
   V8_INLINE static uint32_t StringHash(const void* string);
 
   int GetStringId(const char* s);
+  // Returns the id of a string that GetStringId has already been called for.
+  // Doesn't modify |strings_|, and is thus safe to call from worker threads.
+  int LookupStringId(const char* s) const;
   V8_INLINE int to_node_index(const HeapEntry* e);
   V8_INLINE int to_node_index(int entry_index);
+  int FormatEdge(HeapGraphEdge* edge, bool first_edge, int name_or_index,
+                 base::Vector<char> buffer);
   void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
   void SerializeEdges();
   void SerializeImpl();
+  int FormatNode(const HeapEntry* entry, int name_id,
+                 base::Vector<char> buffer);
   void SerializeNode(const HeapEntry* entry);
   void SerializeNodes();
+  // Formats |count| items in chunks on worker threads, and writes the chunks
+  // to the stream in order. Only a bounded number of chunks is kept in memory
+  // at a time.
+  template <typename FormatItem>
+  void SerializeInParallel(size_t count, FormatItem format_item);
   void SerializeSnapshot();
   void SerializeTraceTree();
   void SerializeTraceNode(AllocationTraceNode* node);
@@ -762,6 +780,36 @@ class HeapSnapshotJSONSerializer {
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Writes a HeapSnapshot in the binary format described at
+// v8::HeapSnapshot::Serialize.
+class HeapSnapshotBinarySerializer {
+ public:
+  static constexpr char kMagic[] = "V8HS";
+  static constexpr uint32_t kVersion = 1;
+
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot) {}
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(const HeapSnapshotBinarySerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  // Names are interned in the profiler's StringsStorage, so strings are
+  // deduplicated by address rather than by contents.
+  uint32_t GetStringId(const char* s);
+  void SerializeImpl();
+  void SerializeStrings();
+  void SerializeNodes();
+  void SerializeEdges();
+  void SerializeLocations();
+
+  HeapSnapshot* snapshot_;
+  std::unordered_map<const char*, uint32_t> string_ids_;
+  std::vector<const char*> strings_;
+  OutputStreamWriter* writer_ = nullptr;
+};
+
 
 }  // namespace internal
 }  // namespace v8
@@ -61,14 +61,19 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
-    const char* s_end = s + n;
-    while (s < s_end) {
-      int s_chunk_size =
-          std::min(chunk_size_ - chunk_pos_, static_cast<int>(s_end - s));
-      DCHECK_GT(s_chunk_size, 0);
-      MemCopy(chunk_.begin() + chunk_pos_, s, s_chunk_size);
-      s += s_chunk_size;
-      chunk_pos_ += s_chunk_size;
+    AddBytes(reinterpret_cast<const uint8_t*>(s), n);
+  }
+  // Unlike AddSubstring, |data| may contain '\0' bytes. Used for binary
+  // output.
+  void AddBytes(const uint8_t* data, int n) {
+    const uint8_t* data_end = data + n;
+    while (data < data_end) {
+      int data_chunk_size =
+          std::min(chunk_size_ - chunk_pos_, static_cast<int>(data_end - data));
+      DCHECK_GT(data_chunk_size, 0);
+      MemCopy(chunk_.begin() + chunk_pos_, data, data_chunk_size);
+      data += data_chunk_size;
+      chunk_pos_ += data_chunk_size;
       MaybeWriteChunk();
     }
   }
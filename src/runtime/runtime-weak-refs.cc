@@ -15,13 +15,8 @@ RUNTIME_FUNCTION(Runtime_ShrinkFinalizationRegistryUnregisterTokenMap) {
   Handle<JSFinalizationRegistry> finalization_registry =
       args.at<JSFinalizationRegistry>(0);
 
-  if (!IsUndefined(finalization_registry->key_map(), isolate)) {
-    Handle<SimpleNumberDictionary> key_map =
-        handle(SimpleNumberDictionary::cast(finalization_registry->key_map()),
-               isolate);
-    key_map = SimpleNumberDictionary::Shrink(isolate, key_map);
-    finalization_registry->set_key_map(*key_map);
-  }
+  JSFinalizationRegistry::ShrinkUnregisterTokenMap(finalization_registry,
+                                                   isolate);
 
   return ReadOnlyRoots(isolate).undefined_value();
 }
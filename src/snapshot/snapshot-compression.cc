@@ -4,7 +4,13 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <atomic>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,49 +18,362 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// The compressed data consists of uint32_t-sized header entries:
+// [0] uncompressed payload length
+// [1] codec
+// [2] number of chunks
+// [3 ...] compressed length of each chunk
+// ... followed by the compressed chunks.
+constexpr uint32_t kUncompressedLengthOffset = 0;
+constexpr uint32_t kCodecOffset = kUncompressedLengthOffset + kUInt32Size;
+constexpr uint32_t kChunkCountOffset = kCodecOffset + kUInt32Size;
+constexpr uint32_t kChunkLengthsOffset = kChunkCountOffset + kUInt32Size;
+
+uint32_t ReadHeaderValue(base::Vector<const uint8_t> data, uint32_t offset) {
+  CHECK_LE(offset + kUInt32Size, data.size());
+  uint32_t value;
+  MemCopy(&value, data.begin() + offset, sizeof(value));
+  return value;
+}
+
+uint32_t ChunkCount(uint32_t uncompressed_length) {
+  return (uncompressed_length + SnapshotCompression::kChunkSize - 1) /
+         SnapshotCompression::kChunkSize;
+}
+
+// An implementation of the LZ4 block format. A block is a sequence of
+//   token: (literal length << 4) | (match length - kMinMatch), where either
+//          nibble is 15 if the length continues in the following bytes,
+//   [literal length - 15 as a run of 255s and a final byte < 255],
+//   literals,
+//   match offset: little-endian uint16_t,
+//   [match length - kMinMatch - 15, encoded like the literal length].
+// The last sequence consists of literals only.
+namespace lz4 {
+
+constexpr int kMinMatch = 4;
+// The last match has to start at least kMatchSafeDistance bytes before the
+// end of the input, and the last kLastLiterals bytes are always literals, so
+// that the decoder can copy in words.
+constexpr int kLastLiterals = 5;
+constexpr int kMatchSafeDistance = 12;
+constexpr uint32_t kMaxOffset = 65535;
+constexpr int kHashBits = 14;
+constexpr uint32_t kLengthMask = 15;
+
+size_t CompressBound(size_t length) { return length + length / 255 + 16; }
+
+uint32_t Read32(const uint8_t* p) {
+  uint32_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+uint32_t Hash(uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+uint8_t* WriteLength(uint8_t* out, size_t length) {
+  for (; length >= 255; length -= 255) *out++ = 255;
+  *out++ = static_cast<uint8_t>(length);
+  return out;
+}
+
+// Writes a token with the literal length and the literals. The caller adds
+// the match length to the token.
+uint8_t* WriteLiterals(uint8_t* out, const uint8_t* literals, size_t length) {
+  uint8_t* token = out++;
+  *token = static_cast<uint8_t>(std::min<size_t>(length, kLengthMask) << 4);
+  if (length >= kLengthMask) out = WriteLength(out, length - kLengthMask);
+  memcpy(out, literals, length);
+  return out + length;
+}
+
+// Greedy compression with a single-entry hash table, like LZ4's fast mode.
+// Returns the compressed length, which is at most CompressBound(length).
+size_t Compress(const uint8_t* input, size_t length, uint8_t* output) {
+  uint8_t* out = output;
+  const uint8_t* literals = input;
+  if (length > kMatchSafeDistance) {
+    std::vector<uint32_t> table(size_t{1} << kHashBits, 0);
+    const uint8_t* const match_limit = input + length - kMatchSafeDistance;
+    const uint8_t* const end_limit = input + length - kLastLiterals;
+    // Position 0 can't be found through the table; that's fine.
+    const uint8_t* p = input + 1;
+    while (p < match_limit) {
+      uint32_t sequence = Read32(p);
+      uint32_t& entry = table[Hash(sequence)];
+      const uint8_t* candidate = input + entry;
+      entry = static_cast<uint32_t>(p - input);
+      if (candidate == input || p - candidate > kMaxOffset ||
+          Read32(candidate) != sequence) {
+        p++;
+        continue;
+      }
+      // Extend the match backwards over pending literals, then forwards.
+      while (p > literals && candidate > input && p[-1] == candidate[-1]) {
+        p--;
+        candidate--;
+      }
+      const uint8_t* match_end = p + kMinMatch;
+      const uint8_t* candidate_end = candidate + kMinMatch;
+      while (match_end < end_limit && *match_end == *candidate_end) {
+        match_end++;
+        candidate_end++;
+      }
+      uint8_t* token = out;
+      out = WriteLiterals(out, literals, p - literals);
+      uint16_t offset = static_cast<uint16_t>(p - candidate);
+      *out++ = static_cast<uint8_t>(offset);
+      *out++ = static_cast<uint8_t>(offset >> 8);
+      size_t match_length = match_end - p - kMinMatch;
+      *token |=
+          static_cast<uint8_t>(std::min<size_t>(match_length, kLengthMask));
+      if (match_length >= kLengthMask) {
+        out = WriteLength(out, match_length - kLengthMask);
+      }
+      p = literals = match_end;
+    }
+  }
+  out = WriteLiterals(out, literals, input + length - literals);
+  return out - output;
+}
+
+// Decompresses exactly |output_length| bytes. The input is trusted (it is
+// covered by the snapshot checksum), but malformed blocks still fail a CHECK
+// rather than writing out of bounds.
+void Decompress(const uint8_t* input, size_t input_length, uint8_t* output,
+                size_t output_length) {
+  const uint8_t* in = input;
+  const uint8_t* const in_end = input + input_length;
+  uint8_t* out = output;
+  uint8_t* const out_end = output + output_length;
+  auto read_length = [&](size_t length) {
+    if (length != kLengthMask) return length;
+    uint8_t byte;
+    do {
+      CHECK_LT(in, in_end);
+      byte = *in++;
+      length += byte;
+    } while (byte == 255);
+    return length;
+  };
+  while (true) {
+    CHECK_LT(in, in_end);
+    uint8_t token = *in++;
+    size_t literal_length = read_length(token >> 4);
+    CHECK_LE(literal_length, static_cast<size_t>(in_end - in));
+    CHECK_LE(literal_length, static_cast<size_t>(out_end - out));
+    memcpy(out, in, literal_length);
+    in += literal_length;
+    out += literal_length;
+    if (in == in_end) break;
+
+    CHECK_LE(2, in_end - in);
+    size_t offset = in[0] | (in[1] << 8);
+    in += 2;
+    CHECK(offset != 0 && offset <= static_cast<size_t>(out - output));
+    size_t match_length = read_length(token & kLengthMask) + kMinMatch;
+    CHECK_LE(match_length, static_cast<size_t>(out_end - out));
+    const uint8_t* match = out - offset;
+    if (offset >= sizeof(uint64_t) &&
+        match_length + sizeof(uint64_t) <= static_cast<size_t>(out_end - out)) {
+      // Copy in words; the source never overlaps the word being written, and
+      // overshooting the match is fine since the output has space for it.
+      uint8_t* const match_end = out + match_length;
+      while (out < match_end) {
+        memcpy(out, match, sizeof(uint64_t));
+        out += sizeof(uint64_t);
+        match += sizeof(uint64_t);
+      }
+      out = match_end;
+    } else {
+      for (size_t i = 0; i < match_length; i++) *out++ = *match++;
+    }
+  }
+  CHECK_EQ(out, out_end);
+}
+
+}  // namespace lz4
+
+size_t CompressBound(SnapshotCompression::Codec codec, size_t length) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib:
+      return compressBound(static_cast<uLong>(length));
+    case SnapshotCompression::Codec::kLz4:
+      return lz4::CompressBound(length);
+  }
+  UNREACHABLE();
+}
+
+size_t CompressChunk(SnapshotCompression::Codec codec, const uint8_t* input,
+                     size_t length, uint8_t* output) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib: {
+      uLongf compressed_length = compressBound(static_cast<uLong>(length));
+      CHECK_EQ(zlib_internal::CompressHelper(
+                   zlib_internal::ZRAW, base::bit_cast<Bytef*>(output),
+                   &compressed_length, base::bit_cast<const Bytef*>(input),
+                   static_cast<uLong>(length), Z_DEFAULT_COMPRESSION, nullptr,
+                   nullptr),
+               Z_OK);
+      return compressed_length;
+    }
+    case SnapshotCompression::Codec::kLz4:
+      return lz4::Compress(input, length, output);
+  }
+  UNREACHABLE();
+}
+
+void DecompressChunk(SnapshotCompression::Codec codec,
+                     base::Vector<const uint8_t> input, uint8_t* output,
+                     size_t output_length) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib: {
+      uLongf uncompressed_length = static_cast<uLongf>(output_length);
+      CHECK_EQ(zlib_internal::UncompressHelper(
+                   zlib_internal::ZRAW, base::bit_cast<Bytef*>(output),
+                   &uncompressed_length,
+                   base::bit_cast<const Bytef*>(input.begin()),
+                   static_cast<uLong>(input.size())),
+               Z_OK);
+      CHECK_EQ(uncompressed_length, output_length);
+      return;
+    }
+    case SnapshotCompression::Codec::kLz4:
+      return lz4::Decompress(input.begin(), input.size(), output,
+                             output_length);
+  }
+  UNREACHABLE();
+}
+
+SnapshotCompression::Codec CodecFromFlag() {
+  const char* name = v8_flags.snapshot_compression_codec;
+  if (strcmp(name, "zlib") == 0) return SnapshotCompression::Codec::kZlib;
+  if (strcmp(name, "lz4") == 0) return SnapshotCompression::Codec::kLz4;
+  FATAL("Unknown snapshot compression codec '%s'", name);
 }
 
+// The chunks of one piece of compressed snapshot data.
+class CompressedChunks {
+ public:
+  explicit CompressedChunks(base::Vector<const uint8_t> data)
+      : uncompressed_length_(
+            ReadHeaderValue(data, kUncompressedLengthOffset)),
+        codec_(static_cast<SnapshotCompression::Codec>(
+            ReadHeaderValue(data, kCodecOffset))),
+        chunk_count_(ReadHeaderValue(data, kChunkCountOffset)) {
+    CHECK(codec_ == SnapshotCompression::Codec::kZlib ||
+          codec_ == SnapshotCompression::Codec::kLz4);
+    CHECK_EQ(chunk_count_, ChunkCount(uncompressed_length_));
+    chunks_.reserve(chunk_count_);
+    size_t offset = kChunkLengthsOffset + chunk_count_ * kUInt32Size;
+    for (uint32_t i = 0; i < chunk_count_; i++) {
+      uint32_t length =
+          ReadHeaderValue(data, kChunkLengthsOffset + i * kUInt32Size);
+      CHECK_LE(offset + length, data.size());
+      chunks_.push_back(data.SubVector(offset, offset + length));
+      offset += length;
+    }
+  }
+
+  uint32_t uncompressed_length() const { return uncompressed_length_; }
+  uint32_t chunk_count() const { return chunk_count_; }
+
+  void DecompressChunk(uint32_t index, uint8_t* output) const {
+    uint32_t start = index * SnapshotCompression::kChunkSize;
+    uint32_t length = std::min(SnapshotCompression::kChunkSize,
+                               uncompressed_length_ - start);
+    internal::DecompressChunk(codec_, chunks_[index], output + start, length);
+  }
+
+ private:
+  const uint32_t uncompressed_length_;
+  const SnapshotCompression::Codec codec_;
+  const uint32_t chunk_count_;
+  std::vector<base::Vector<const uint8_t>> chunks_;
+};
+
+class DecompressionJob final : public JobTask {
+ public:
+  DecompressionJob(const CompressedChunks* chunks, uint8_t* output)
+      : chunks_(chunks),
+        output_(output),
+        remaining_chunks_(chunks->chunk_count()) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      uint32_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->chunk_count()) return;
+      chunks_->DecompressChunk(index, output_);
+      remaining_chunks_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return remaining_chunks_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const CompressedChunks* const chunks_;
+  uint8_t* const output_;
+  std::atomic<uint32_t> next_chunk_{0};
+  std::atomic<size_t> remaining_chunks_;
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  return Compress(uncompressed_data, CodecFromFlag());
+}
+
+SnapshotData SnapshotCompression::Compress(
+    const SnapshotData* uncompressed_data, Codec codec) {
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(input.size());
+  uint32_t chunk_count = ChunkCount(payload_length);
+  uint32_t header_size = kChunkLengthsOffset + chunk_count * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
-
+  size_t max_size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    max_size += CompressBound(
+        codec, std::min(kChunkSize, payload_length - i * kChunkSize));
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_size));
   uint8_t* compressed_data =
       const_cast<uint8_t*>(snapshot_data.RawData().begin());
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          base::bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
-
-  // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+
+  uint32_t codec_value = static_cast<uint32_t>(codec);
+  MemCopy(compressed_data + kUncompressedLengthOffset, &payload_length,
+          sizeof(payload_length));
+  MemCopy(compressed_data + kCodecOffset, &codec_value, sizeof(codec_value));
+  MemCopy(compressed_data + kChunkCountOffset, &chunk_count,
+          sizeof(chunk_count));
+  uint32_t size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t start = i * kChunkSize;
+    uint32_t compressed_length = static_cast<uint32_t>(
+        CompressChunk(codec, input.begin() + start,
+                      std::min(kChunkSize, payload_length - start),
+                      compressed_data + size));
+    MemCopy(compressed_data + kChunkLengthsOffset + i * kUInt32Size,
+            &compressed_length, sizeof(compressed_length));
+    size += compressed_length;
+  }
+
+  // Shrinking to exactly the size we need.
+  snapshot_data.Resize(size);
+  DCHECK_EQ(payload_length, CompressedChunks(snapshot_data.RawData())
+                                .uncompressed_length());
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -69,29 +388,26 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      base::bit_cast<const Bytef*>(compressed_data.begin());
+  CompressedChunks chunks(compressed_data);
+  snapshot_data.AllocateData(chunks.uncompressed_length());
+  uint8_t* output = const_cast<uint8_t*>(snapshot_data.RawData().begin());
 
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
-
-  snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               base::bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  if (chunks.chunk_count() > 1 &&
+      v8_flags.parallel_snapshot_decompression) {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<DecompressionJob>(&chunks, output))
+        ->Join();
+  } else {
+    for (uint32_t i = 0; i < chunks.chunk_count(); i++) {
+      chunks.DecompressChunk(i, output);
+    }
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+           chunks.uncompressed_length(), ms);
   }
   return snapshot_data;
 }
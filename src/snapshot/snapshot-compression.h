@@ -11,10 +11,26 @@
 namespace v8 {
 namespace internal {
 
+// Compressed snapshot data is split into chunks of kChunkSize uncompressed
+// bytes that are compressed independently, so that they can be decompressed
+// in parallel. The codec is recorded in the data, so snapshots compressed with
+// any codec can be decompressed.
 class SnapshotCompression : public AllStatic {
  public:
+  enum class Codec : uint32_t {
+    // zlib's raw deflate format: best compression, slow decompression.
+    kZlib,
+    // The LZ4 block format: worse compression, very fast decompression.
+    kLz4,
+  };
+
+  static constexpr uint32_t kChunkSize = 256 * KB;
+
+  // Compresses with the codec selected by --snapshot-compression-codec.
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      const SnapshotData* uncompressed_data, Codec codec);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       base::Vector<const uint8_t> compressed_data);
 };
@@ -6,7 +6,12 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <algorithm>
+
 #include "src/api/api-inl.h"  // For OpenHandle.
+#include "src/base/lazy-instance.h"
+#include "src/base/once.h"
+#include "src/base/platform/mutex.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/local-isolate-inl.h"
@@ -131,11 +136,133 @@ class SnapshotImpl : public AllStatic {
 
 }  // namespace
 
-SnapshotData MaybeDecompress(Isolate* isolate,
+struct SharedSnapshotData::BlobData {
+  BlobData(const char* data, int raw_size, uint32_t checksum)
+      : data(data), raw_size(raw_size), checksum(checksum) {}
+
+  bool Is(const v8::StartupData* blob) const {
+    return blob->data == data && blob->raw_size == raw_size &&
+           Snapshot::GetExpectedChecksum(blob) == checksum;
+  }
+
+  // The identity of the blob.
+  const char* const data;
+  const int raw_size;
+  const uint32_t checksum;
+
+  int users = 0;
+  bool checksum_verified = false;
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // A compressed section of the blob. It is decompressed outside of the mutex,
+  // by the first isolate that needs it, while isolates needing the same
+  // section wait for it.
+  struct Section {
+    base::OnceType decompressed = V8_ONCE_INIT;
+    std::unique_ptr<SnapshotData> data;
+  };
+  std::unordered_map<const uint8_t*, std::unique_ptr<Section>> sections;
+#endif  // V8_SNAPSHOT_COMPRESSION
+};
+
+SharedSnapshotData::SharedSnapshotData() = default;
+SharedSnapshotData::~SharedSnapshotData() = default;
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedSnapshotData, GetSharedSnapshotData)
+}  // namespace
+
+// static
+SharedSnapshotData* SharedSnapshotData::Get() {
+  return GetSharedSnapshotData();
+}
+
+// static
+bool SharedSnapshotData::ShouldShare(const v8::StartupData* blob) {
+  return v8_flags.share_snapshot_data &&
+         blob == Snapshot::DefaultSnapshotBlob();
+}
+
+bool SharedSnapshotData::Acquire(Isolate* isolate,
+                                 const v8::StartupData* blob) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(users_.count(isolate), 0);
+  BlobData* blob_data = nullptr;
+  for (const std::unique_ptr<BlobData>& candidate : blobs_) {
+    if (candidate->Is(blob)) {
+      blob_data = candidate.get();
+      break;
+    }
+  }
+  if (blob_data == nullptr) {
+    blobs_.push_back(std::make_unique<BlobData>(
+        blob->data, blob->raw_size, Snapshot::GetExpectedChecksum(blob)));
+    blob_data = blobs_.back().get();
+  }
+  blob_data->users++;
+  users_.emplace(isolate, blob_data);
+  return !blob_data->checksum_verified;
+}
+
+void SharedSnapshotData::SetChecksumVerified(Isolate* isolate) {
+  base::MutexGuard guard(&mutex_);
+  auto it = users_.find(isolate);
+  DCHECK(it != users_.end());
+  it->second->checksum_verified = true;
+}
+
+void SharedSnapshotData::Release(Isolate* isolate) {
+  base::MutexGuard guard(&mutex_);
+  auto it = users_.find(isolate);
+  if (it == users_.end()) return;
+  BlobData* blob_data = it->second;
+  users_.erase(it);
+  if (--blob_data->users > 0) return;
+  auto blob_it = std::find_if(blobs_.begin(), blobs_.end(),
+                              [blob_data](const std::unique_ptr<BlobData>& b) {
+                                return b.get() == blob_data;
+                              });
+  DCHECK(blob_it != blobs_.end());
+  blobs_.erase(blob_it);
+}
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+base::Vector<const uint8_t> SharedSnapshotData::Decompress(
+    Isolate* isolate, base::Vector<const uint8_t> compressed_data) {
+  BlobData::Section* section;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto user = users_.find(isolate);
+    if (user == users_.end()) return {};
+    std::unique_ptr<BlobData::Section>& entry =
+        user->second->sections[compressed_data.begin()];
+    if (!entry) entry = std::make_unique<BlobData::Section>();
+    // The section is owned by the blob data, which outlives this call as
+    // |isolate| holds a reference to it.
+    section = entry.get();
+  }
+  base::CallOnce(&section->decompressed, [section, compressed_data]() {
+    section->data = std::make_unique<SnapshotData>(
+        SnapshotCompression::Decompress(compressed_data));
+  });
+  return section->data->RawData();
+}
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+size_t SharedSnapshotData::blob_count_for_testing() {
+  base::MutexGuard guard(&mutex_);
+  return blobs_.size();
+}
+
+SnapshotData MaybeDecompress(Isolate* isolate, const v8::StartupData* blob,
                              base::Vector<const uint8_t> snapshot_data) {
 #ifdef V8_SNAPSHOT_COMPRESSION
   TRACE_EVENT0("v8", "V8.SnapshotDecompress");
   RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
+  if (SharedSnapshotData::ShouldShare(blob)) {
+    base::Vector<const uint8_t> shared =
+        SharedSnapshotData::Get()->Decompress(isolate, snapshot_data);
+    if (!shared.empty()) return SnapshotData(shared);
+  }
   return SnapshotCompression::Decompress(snapshot_data);
 #else
   return SnapshotData(snapshot_data);
@@ -175,7 +302,16 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   SnapshotImpl::CheckVersion(blob);
-  if (Snapshot::ShouldVerifyChecksum(blob)) {
+  if (SharedSnapshotData::ShouldShare(blob)) {
+    SharedSnapshotData* shared = SharedSnapshotData::Get();
+    // Concurrently created isolates may both verify the checksum, which is
+    // harmless.
+    if (shared->Acquire(isolate, blob) &&
+        Snapshot::ShouldVerifyChecksum(blob)) {
+      CHECK(VerifyChecksum(blob));
+      shared->SetChecksumVerified(isolate);
+    }
+  } else if (Snapshot::ShouldVerifyChecksum(blob)) {
     CHECK(VerifyChecksum(blob));
   }
 
@@ -186,11 +322,12 @@ bool Snapshot::Initialize(Isolate* isolate) {
   base::Vector<const uint8_t> shared_heap_data =
       SnapshotImpl::ExtractSharedHeapData(blob);
 
-  SnapshotData startup_snapshot_data(MaybeDecompress(isolate, startup_data));
+  SnapshotData startup_snapshot_data(
+      MaybeDecompress(isolate, blob, startup_data));
   SnapshotData read_only_snapshot_data(
-      MaybeDecompress(isolate, read_only_data));
+      MaybeDecompress(isolate, blob, read_only_data));
   SnapshotData shared_heap_snapshot_data(
-      MaybeDecompress(isolate, shared_heap_data));
+      MaybeDecompress(isolate, blob, shared_heap_data));
 
   return isolate->InitWithSnapshot(
       &startup_snapshot_data, &read_only_snapshot_data,
@@ -206,7 +343,7 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   bool can_rehash = ExtractRehashability(blob);
   base::Vector<const uint8_t> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
-  SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
+  SnapshotData snapshot_data(MaybeDecompress(isolate, blob, context_data));
 
   return ContextDeserializer::DeserializeContext(
       isolate, &snapshot_data, context_index, can_rehash, global_proxy,
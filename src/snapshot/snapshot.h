@@ -5,10 +5,14 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_H_
 #define V8_SNAPSHOT_SNAPSHOT_H_
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "include/v8-array-buffer.h"  // For ArrayBuffer::Allocator.
 #include "include/v8-snapshot.h"  // For StartupData.
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 
@@ -118,6 +122,60 @@ class Snapshot : public AllStatic {
 #endif  // DEBUG
 };
 
+// Work on the default snapshot blob that is shared between the isolates created
+// from it (see --share-snapshot-data): its checksum is verified once, and each
+// of its compressed sections is decompressed by the first isolate that needs
+// it. Context snapshots in particular are only decompressed when the first
+// context is created from them. Deserialization is not lazy though: each
+// isolate and context still deserializes the whole section it is created
+// from. Blobs passed in by the embedder may be freed after isolate creation
+// and are handled per isolate.
+//
+// The shared data is keyed by the identity of the blob (its data pointer, size
+// and checksum), so a default blob that was replaced is never served from
+// stale data. It is reference counted by the isolates using it, and freed
+// when the last of them is torn down.
+class V8_EXPORT_PRIVATE SharedSnapshotData final {
+ public:
+  SharedSnapshotData();
+  ~SharedSnapshotData();
+  SharedSnapshotData(const SharedSnapshotData&) = delete;
+  SharedSnapshotData& operator=(const SharedSnapshotData&) = delete;
+
+  // The process-wide instance used for the default snapshot blob.
+  static SharedSnapshotData* Get();
+
+  static bool ShouldShare(const v8::StartupData* blob);
+
+  // Registers |isolate| as a user of the shared data of |blob|. Returns
+  // whether the checksum of |blob| still needs to be verified.
+  bool Acquire(Isolate* isolate, const v8::StartupData* blob);
+  // Records that the checksum of the blob used by |isolate| was verified.
+  void SetChecksumVerified(Isolate* isolate);
+  // Drops the reference of |isolate|, freeing the shared data of its blob if
+  // it was the last user. Does nothing for isolates that aren't registered.
+  void Release(Isolate* isolate);
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Returns the decompressed data for |compressed_data|, which must be a
+  // section of the blob used by |isolate|, or an empty vector if |isolate|
+  // isn't registered. The result stays valid until |isolate| is released.
+  // Decompression doesn't hold the lock, so it only blocks isolates that need
+  // the same section.
+  base::Vector<const uint8_t> Decompress(
+      Isolate* isolate, base::Vector<const uint8_t> compressed_data);
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  size_t blob_count_for_testing();
+
+ private:
+  struct BlobData;
+
+  base::Mutex mutex_;
+  std::vector<std::unique_ptr<BlobData>> blobs_;
+  std::unordered_map<Isolate*, BlobData*> users_;
+};
+
 // Convenience wrapper around snapshot data blob creation used e.g. by tests and
 // mksnapshot.
 V8_EXPORT_PRIVATE v8::StartupData CreateSnapshotDataBlobInternal(
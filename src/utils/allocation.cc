@@ -361,6 +361,13 @@ bool VirtualMemoryCage::InitReservation(
       params.reservation_size - (allocatable_base - base_), params.page_size);
   size_ = allocatable_base + allocatable_size - base_;
 
+  if (params.huge_pages) {
+    // The advice is kept when permissions of parts of the range are changed
+    // later on. It's only a hint, so failures are ignored.
+    params.page_allocator->AdviseHugePages(
+        reinterpret_cast<void*>(allocatable_base), allocatable_size);
+  }
+
   const base::PageFreeingMode page_freeing_mode =
       V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT &&
               params.jit == JitPermission::kMapAsJittable
@@ -387,6 +387,9 @@ class VirtualMemoryCage {
     size_t page_size;
     Address requested_start_hint;
     JitPermission jit;
+    // Whether to advise the OS to back the reservation with huge pages, see
+    // v8::PageAllocator::AdviseHugePages.
+    bool huge_pages = false;
 
     static constexpr size_t kAnyBaseAlignment = 1;
   };
@@ -0,0 +1,104 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "src/bigint/bigint-internal.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::bigint::digit_t;
+using v8::bigint::Digits;
+using v8::bigint::FromStringAccumulator;
+using v8::bigint::Platform;
+using v8::bigint::Processor;
+using v8::bigint::ProcessorImpl;
+using v8::bigint::RWDigits;
+using v8::bigint::ScratchDigits;
+
+// Conversions between BigInts and decimal strings, comparing the classic
+// quadratic algorithms with the divide-and-conquer ones that are used above
+// kToStringFastThreshold and kFromStringLargeThreshold respectively. The
+// argument is the BigInt's length in digits.
+enum class Algorithm { kClassic, kFast };
+
+class BigIntConversion {
+ public:
+  explicit BigIntConversion(int length)
+      : processor_(Processor::New(new Platform())), digits_(length) {
+    std::mt19937_64 rng(length);
+    for (int i = 0; i < length; i++) digits_[i] = static_cast<digit_t>(rng());
+    if (digits_.msd() == 0) digits_[length - 1] = 1;
+  }
+
+  ProcessorImpl* processor() {
+    return static_cast<ProcessorImpl*>(processor_.get());
+  }
+  Digits digits() { return digits_; }
+
+  std::string ToString(Algorithm algorithm) {
+    int length = v8::bigint::ToStringResultLength(digits_, 10, false);
+    std::string result(length, '\0');
+    processor()->ToStringImpl(result.data(), &length, digits_, 10, false,
+                              algorithm == Algorithm::kFast);
+    result.resize(length);
+    return result;
+  }
+
+ private:
+  std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  ScratchDigits digits_;
+};
+
+template <Algorithm algorithm>
+void BigIntToString(benchmark::State& state) {
+  BigIntConversion conversion(static_cast<int>(state.range(0)));
+  int64_t chars = 0;
+  for (auto _ : state) {
+    std::string result = conversion.ToString(algorithm);
+    chars += result.size();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(chars);
+}
+
+template <Algorithm algorithm>
+void BigIntFromString(benchmark::State& state) {
+  BigIntConversion conversion(static_cast<int>(state.range(0)));
+  std::string input = conversion.ToString(Algorithm::kFast);
+  for (auto _ : state) {
+    FromStringAccumulator accumulator(1 << 24);
+    accumulator.Parse(input.data(), input.data() + input.size(), 10);
+    ScratchDigits result(accumulator.ResultLength());
+    if (algorithm == Algorithm::kFast) {
+      conversion.processor()->FromStringLarge(result, &accumulator);
+    } else {
+      conversion.processor()->FromStringClassic(result, &accumulator);
+    }
+    benchmark::DoNotOptimize(result.digits());
+  }
+  state.SetItemsProcessed(state.iterations() * input.size());
+}
+
+}  // namespace
+
+// The classic algorithms take too long beyond a few ten thousand digits.
+BENCHMARK_TEMPLATE(BigIntToString, Algorithm::kClassic)
+    ->RangeMultiplier(4)
+    ->Range(64, 16 << 10);
+BENCHMARK_TEMPLATE(BigIntFromString, Algorithm::kClassic)
+    ->RangeMultiplier(4)
+    ->Range(64, 16 << 10);
+BENCHMARK_TEMPLATE(BigIntFromString, Algorithm::kFast)
+    ->RangeMultiplier(4)
+    ->Range(64, 1 << 20);
+// The fast toString algorithm relies on Barrett division.
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+BENCHMARK_TEMPLATE(BigIntToString, Algorithm::kFast)
+    ->RangeMultiplier(4)
+    ->Range(64, 1 << 20);
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
@@ -33,6 +33,30 @@ BENCHMARK_F(Allocate, Tiny)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(TinyObject));
 }
 
+template <size_t Size>
+class MediumObject final : public GarbageCollected<MediumObject<Size>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[Size];
+};
+
+BENCHMARK_F(Allocate, Mixed)(benchmark::State& st) {
+  subtle::NoGarbageCollectionScope no_gc(*Heap::From(&heap()));
+  for (auto _ : st) {
+    USE(_);
+    // Sizes that map to different spaces, as in typical embedder heaps.
+    benchmark::DoNotOptimize(MakeGarbageCollected<MediumObject<200>>(
+        heap().GetAllocationHandle()));
+    benchmark::DoNotOptimize(MakeGarbageCollected<MediumObject<48>>(
+        heap().GetAllocationHandle()));
+    benchmark::DoNotOptimize(MakeGarbageCollected<MediumObject<1000>>(
+        heap().GetAllocationHandle()));
+  }
+  st.SetBytesProcessed(st.iterations() *
+                       (sizeof(MediumObject<200>) + sizeof(MediumObject<48>) +
+                        sizeof(MediumObject<1000>)));
+}
+
 class LargeObject final : public GarbageCollected<LargeObject> {
  public:
   void Trace(cppgc::Visitor*) const {}
@@ -10,6 +10,7 @@
 #include "include/cppgc/persistent.h"
 #include "include/cppgc/visitor.h"
 #include "src/base/macros.h"
+#include "src/heap/cppgc/heap.h"
 #include "src/heap/cppgc/object-allocator.h"
 #include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
 #include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
@@ -103,3 +104,19 @@ BENCHMARK_F(BinaryTrees, V1)(benchmark::State& st) {
     RunBinaryTrees(heap());
   }
 }
+
+#if defined(CPPGC_YOUNG_GENERATION)
+// Same as V1, with minor GCs collecting the short-lived trees.
+BENCHMARK_F(BinaryTrees, Generational)(benchmark::State& st) {
+  auto* internal_heap = cppgc::internal::Heap::From(&heap());
+  // Takes effect with the first GC.
+  internal_heap->EnableGenerationalGC();
+  for (auto _ : st) {
+    USE(_);
+    RunBinaryTrees(heap());
+  }
+  // Leaves generational mode, which would otherwise keep the write barrier
+  // enabled for other benchmarks in the same process.
+  internal_heap->Terminate();
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
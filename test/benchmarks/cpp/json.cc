@@ -0,0 +1,102 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+enum class Encoding { kOneByte, kTwoByte };
+
+v8::Isolate* GetIsolate() {
+  static v8::Isolate* isolate = [] {
+    static std::unique_ptr<v8::Platform> platform =
+        v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    static std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator.get();
+    return v8::Isolate::New(create_params);
+  }();
+  return isolate;
+}
+
+// A document that consists mostly of string contents, with the occasional
+// escape sequence, which is where the string scanners spend their time.
+v8::Local<v8::String> MakeDocument(v8::Isolate* isolate, Encoding encoding) {
+  std::u16string text =
+      u"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+      u"eiusmod tempor incididunt ut labore et dolore magna aliqua.";
+  if (encoding == Encoding::kTwoByte) text += u" \u4e2d\u6587";
+  std::u16string json = u"[";
+  for (int i = 0; i < 10000; i++) {
+    if (i > 0) json += u",";
+    json += u"{\"text\":\"" + text + u"\",\"escaped\":\"a\\\"b\\\\c\\n\"}";
+  }
+  json += u"]";
+  // One-byte representable strings are created as one-byte strings.
+  return v8::String::NewFromTwoByte(
+             isolate, reinterpret_cast<const uint16_t*>(json.data()),
+             v8::NewStringType::kNormal, static_cast<int>(json.size()))
+      .ToLocalChecked();
+}
+
+int64_t SizeInBytes(v8::Local<v8::String> string) {
+  return static_cast<int64_t>(string->Length()) *
+         (string->IsOneByte() ? sizeof(uint8_t) : sizeof(uint16_t));
+}
+
+template <Encoding encoding>
+void JsonParse(benchmark::State& state) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::String> source = MakeDocument(isolate, encoding);
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    benchmark::DoNotOptimize(v8::JSON::Parse(context, source).ToLocalChecked());
+  }
+  state.SetBytesProcessed(state.iterations() * SizeInBytes(source));
+}
+
+template <Encoding encoding>
+void JsonStringify(benchmark::State& state) {
+  v8::Isolate* isolate = GetIsolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context, MakeDocument(isolate, encoding))
+          .ToLocalChecked();
+  int64_t bytes = 0;
+  for (auto _ : state) {
+    v8::HandleScope iteration_scope(isolate);
+    v8::Local<v8::String> result =
+        v8::JSON::Stringify(context, value).ToLocalChecked();
+    bytes += SizeInBytes(result);
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(JsonParse, Encoding::kOneByte);
+BENCHMARK_TEMPLATE(JsonParse, Encoding::kTwoByte);
+BENCHMARK_TEMPLATE(JsonStringify, Encoding::kOneByte);
+BENCHMARK_TEMPLATE(JsonStringify, Encoding::kTwoByte);
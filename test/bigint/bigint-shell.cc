@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -33,6 +36,7 @@ int PrintHelp(char** argv) {
   V(kBarrett, "barrett")             \
   V(kBurnikel, "burnikel")           \
   V(kFFT, "fft")                     \
+  V(kFFTParallel, "fftparallel")     \
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
@@ -123,6 +127,26 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs parallel work items on a few std::threads, to exercise the library's
+// parallel code paths without an embedder.
+class ThreadedPlatform : public Platform {
+ public:
+  static constexpr int kWorkerThreads = 3;
+
+  int NumberOfWorkerThreads() override { return kWorkerThreads; }
+
+  void RunInParallel(ParallelWork* work, int count) override {
+    std::atomic<int> next_item{0};
+    auto run = [work, count, &next_item]() {
+      for (int i = next_item++; i < count; i = next_item++) work->Run(i);
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWorkerThreads; i++) threads.emplace_back(run);
+    run();
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -130,12 +154,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadedPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -200,6 +229,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestFFT(&count);
       }
+    } else if (test_ == kFFTParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestFFTParallel(&count);
+      }
     } else if (test_ == kKaratsuba) {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
@@ -311,6 +344,39 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestFFTParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // These are even larger, so we only test a few random samples just above
+    // the threshold, including squaring. The threshold applies to the sum of
+    // both lengths, so {right_size} alone must reach half of it.
+    for (int i = 0; i < 3; i++) {
+      uint64_t random_bits = rng_.NextUint64();
+      int right_size =
+          kFftParallelThreshold / 2 + static_cast<int>(random_bits & 1023);
+      random_bits >>= 10;
+      int left_size = right_size + static_cast<int>(random_bits & 1023);
+      random_bits >>= 10;
+      bool square = i == 0;
+      if (square) left_size = right_size;
+      DCHECK(left_size + right_size >= kFftParallelThreshold);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      Digits X = A;
+      Digits Y = square ? Digits(A) : Digits(B);
+      int result_len = MultiplyResultLength(X, Y);
+      ScratchDigits result(result_len);
+      ScratchDigits result_sequential(result_len);
+      parallel_processor()->MultiplyFFT(result, X, Y);
+      processor()->MultiplyFFT(result_sequential, X, Y);
+      AssertEquals(X, Y, result_sequential, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -617,6 +683,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
@@ -491,6 +491,36 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+TEST(ArrayBuffer_ParallelRelease) {
+  v8_flags.concurrent_array_buffer_sweeping = false;
+  v8_flags.parallel_array_buffer_release = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+
+  heap::InvokeAtomicMajorGC(heap);
+  const size_t backing_store_before = heap->backing_store_bytes();
+  // Enough dead array buffers for several batches.
+  const int kArrayBuffers = 10000;
+  const size_t kArraybufferSize = 117;
+  {
+    v8::HandleScope handle_scope(isolate);
+    // All buffers stay alive through the handle scope until the GC below.
+    for (int i = 0; i < kArrayBuffers; i++) {
+      Local<v8::ArrayBuffer> ab =
+          v8::ArrayBuffer::New(isolate, kArraybufferSize);
+      CHECK(IsTracked(heap, *v8::Utils::OpenHandle(*ab)));
+    }
+    CHECK_EQ(kArrayBuffers * kArraybufferSize,
+             heap->backing_store_bytes() - backing_store_before);
+  }
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK_EQ(backing_store_before, heap->backing_store_bytes());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
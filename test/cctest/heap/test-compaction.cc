@@ -4,6 +4,7 @@
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-state-inl.h"
@@ -428,6 +429,64 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+HEAP_TEST(CompactionAbortedOverPauseBudget) {
+  if (!v8_flags.compact) return;
+  // Test that candidates that don't fit into the pause budget are left in
+  // place, preferring those that free a page for the least work.
+  ManualGCScope manual_gc_scope;
+  heap::ManualEvacuationCandidatesSelectionScope
+      manual_evacuation_candidate_selection_scope(manual_gc_scope);
+  v8_flags.parallel_compaction = false;
+  v8_flags.evacuation_pause_budget_ms = 1;
+
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  const int page_size =
+      static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage());
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    {
+      HandleScope scope2(isolate);
+      CHECK(heap->old_space()->TryExpandImpl(
+          MemoryAllocator::AllocationMode::kRegular));
+      auto full_page_handles =
+          heap::CreatePadding(heap, page_size, AllocationType::kOld);
+      Page* full_page = Page::FromHeapObject(*full_page_handles.front());
+      CheckAllObjectsOnPage(full_page_handles, full_page);
+
+      CHECK(heap->old_space()->TryExpandImpl(
+          MemoryAllocator::AllocationMode::kRegular));
+      auto sparse_page_handles =
+          heap::CreatePadding(heap, page_size / 4, AllocationType::kOld);
+      Page* sparse_page = Page::FromHeapObject(*sparse_page_handles.front());
+      CheckAllObjectsOnPage(sparse_page_handles, sparse_page);
+
+      full_page->SetFlag(MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+      sparse_page->SetFlag(
+          MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+
+      // Pretend that a single task compacts a page per millisecond, so that
+      // only the sparse page fits into the budget.
+      for (int i = 0; i < 10; i++) {
+        heap->tracer()->AddCompactionEvent(1, page_size);
+      }
+      heap::InvokeMajorGC(heap);
+      heap->EnsureSweepingCompleted(
+          Heap::SweepingForcedFinalizationMode::kV8Only);
+
+      for (Handle<FixedArray> object : sparse_page_handles) {
+        CHECK_NE(sparse_page, Page::FromHeapObject(*object));
+      }
+      CheckAllObjectsOnPage(full_page_handles, full_page);
+      CheckInvariantsOfAbortedPage(full_page);
+    }
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
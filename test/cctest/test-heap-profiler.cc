@@ -29,7 +29,10 @@
 
 #include <ctype.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/v8-function.h"
 #include "include/v8-json.h"
@@ -51,6 +54,7 @@
 #include "test/cctest/collector.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/jsonstream-helper.h"
+#include "test/common/heap-retention-summary-utils.h"
 
 using i::AllocationTraceNode;
 using i::AllocationTraceTree;
@@ -1193,6 +1197,156 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(HeapSnapshotJSONSerializationInParallel) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  // Enough nodes and edges for several chunks.
+  CompileRun(
+      "var a = [];\n"
+      "for (var i = 0; i < 50000; i++) a.push({x: {y: i}});");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  i::v8_flags.heap_snapshot_parallel_serialization = false;
+  v8::internal::TestJSONStream sequential_stream;
+  snapshot->Serialize(&sequential_stream, v8::HeapSnapshot::kJSON);
+  i::v8_flags.heap_snapshot_parallel_serialization = true;
+  v8::internal::TestJSONStream parallel_stream;
+  snapshot->Serialize(&parallel_stream, v8::HeapSnapshot::kJSON);
+  CHECK_EQ(1, parallel_stream.eos_signaled());
+
+  // The parallel serialization produces exactly the same JSON.
+  CHECK_EQ(sequential_stream.size(), parallel_stream.size());
+  v8::base::ScopedVector<char> sequential_json(sequential_stream.size());
+  sequential_stream.WriteTo(sequential_json);
+  v8::base::ScopedVector<char> parallel_json(parallel_stream.size());
+  parallel_stream.WriteTo(parallel_json);
+  CHECK_EQ(0, memcmp(sequential_json.begin(), parallel_json.begin(),
+                     sequential_json.length()));
+
+  // Aborting works in the middle of parallel serialization as well.
+  v8::internal::TestJSONStream aborted_stream(5);
+  snapshot->Serialize(&aborted_stream, v8::HeapSnapshot::kJSON);
+  CHECK_EQ(0, aborted_stream.eos_signaled());
+  i::v8_flags.heap_snapshot_parallel_serialization = false;
+}
+
+namespace {
+
+class BinarySnapshotReader {
+ public:
+  explicit BinarySnapshotReader(v8::base::Vector<char> data) : data_(data) {}
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(position_, data_.length());
+      uint8_t byte = static_cast<uint8_t>(data_[position_++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  int64_t ReadZigZag() {
+    uint64_t value = ReadVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  std::string ReadBytes(size_t length) {
+    CHECK_LE(position_ + length, data_.length());
+    std::string result(data_.begin() + position_, length);
+    position_ += length;
+    return result;
+  }
+
+  bool AtEnd() const { return position_ == data_.length(); }
+
+ private:
+  v8::base::Vector<char> data_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('a string in a binary snapshot');\n"
+      "var b = [a, a];");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  i::HeapSnapshot* i_snapshot = const_cast<i::HeapSnapshot*>(
+      reinterpret_cast<const i::HeapSnapshot*>(snapshot));
+
+  v8::internal::TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  v8::base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  BinarySnapshotReader reader(data);
+  CHECK_EQ(reader.ReadBytes(4), "V8HS");
+  CHECK_EQ(1u, reader.ReadVarint());
+  std::vector<std::string> strings(reader.ReadVarint());
+  for (std::string& string : strings) {
+    string = reader.ReadBytes(reader.ReadVarint());
+  }
+  CHECK(std::find(strings.begin(), strings.end(),
+                  "a string in a binary snapshot") != strings.end());
+
+  CHECK_EQ(i_snapshot->entries().size(), reader.ReadVarint());
+  int64_t id = 0;
+  for (const i::HeapEntry& entry : i_snapshot->entries()) {
+    CHECK_EQ(static_cast<uint64_t>(entry.type()), reader.ReadVarint());
+    CHECK_EQ(std::string(entry.name()), strings.at(reader.ReadVarint()));
+    id += reader.ReadZigZag();
+    CHECK_EQ(static_cast<int64_t>(entry.id()), id);
+    CHECK_EQ(entry.self_size(), reader.ReadVarint());
+    CHECK_EQ(static_cast<uint64_t>(entry.children_count()),
+             reader.ReadVarint());
+    CHECK_EQ(entry.trace_node_id(), reader.ReadVarint());
+    CHECK_EQ(entry.detachedness(), reader.ReadVarint());
+  }
+
+  CHECK_EQ(i_snapshot->children().size(), reader.ReadVarint());
+  for (i::HeapGraphEdge* edge : i_snapshot->children()) {
+    CHECK_EQ(static_cast<uint64_t>(edge->type()), reader.ReadVarint());
+    if (edge->type() == i::HeapGraphEdge::kElement ||
+        edge->type() == i::HeapGraphEdge::kHidden) {
+      CHECK_EQ(static_cast<uint64_t>(edge->index()), reader.ReadVarint());
+    } else {
+      CHECK_EQ(std::string(edge->name()), strings.at(reader.ReadVarint()));
+    }
+    CHECK_EQ(static_cast<uint64_t>(edge->to()->index()), reader.ReadVarint());
+  }
+
+  CHECK_EQ(i_snapshot->locations().size(), reader.ReadVarint());
+  for (size_t i = 0; i < i_snapshot->locations().size() * 4; i++) {
+    reader.ReadVarint();
+  }
+  CHECK(reader.AtEnd());
+
+  v8::internal::TestJSONStream json_stream;
+  snapshot->Serialize(&json_stream, v8::HeapSnapshot::kJSON);
+  CHECK_LT(stream.size(), json_stream.size());
+}
+
+TEST(HeapSnapshotBinarySerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  v8::internal::TestJSONStream stream(5);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
@@ -4242,3 +4396,61 @@ TEST(ObjectRetainedInDirectHandle) {
   // Make sure to keep the handle alive.
   CHECK(!direct.is_null());
 }
+
+TEST(RetentionSummary) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::HeapProfiler* heap_profiler = isolate->GetHeapProfiler();
+  CompileRun(
+      "function Holder() { this.payload = new Array(10000).fill(0.5); }\n"
+      "function Inner() {}\n"
+      "function Outer() { this.inner = new Inner(); }\n"
+      "var holders = [new Holder(), new Holder()];\n"
+      "var outer = new Outer();\n"
+      "outer.inner.nested = new Outer();");
+  const int snapshots_count = heap_profiler->GetSnapshotCount();
+
+  std::unique_ptr<i::RetentionSummary> result =
+      i::TakeRetentionSummaryForTesting(isolate);
+  // The snapshot the summary is computed from is not kept.
+  CHECK_EQ(snapshots_count, heap_profiler->GetSnapshotCount());
+
+  const i::RetentionSummary& summary = *result;
+  CHECK_GT(summary.total_size, 0);
+  CHECK_LE(summary.classes.size(), 32);
+  for (size_t i = 1; i < summary.classes.size(); ++i) {
+    CHECK_GE(summary.classes[i - 1].retained_size,
+             summary.classes[i].retained_size);
+  }
+
+  // Each holder retains its payload.
+  const i::RetentionSummary::Class* holder =
+      i::FindRetentionSummaryClass(summary, "Holder");
+  CHECK_NOT_NULL(holder);
+  CHECK(!holder->is_native);
+  CHECK_EQ(2, holder->count);
+  CHECK_GT(holder->retained_size, 2 * 10000 * sizeof(double));
+  CHECK_LE(holder->retained_size, summary.total_size);
+  CHECK(!holder->retaining_path.empty());
+
+  // The nested Outer is retained by the outer one, which is the only one
+  // counted for the retained size of the class.
+  const i::RetentionSummary::Class* outer =
+      i::FindRetentionSummaryClass(summary, "Outer");
+  CHECK_NOT_NULL(outer);
+  CHECK_EQ(2, outer->count);
+  const i::RetentionSummary::Class* inner =
+      i::FindRetentionSummaryClass(summary, "Inner");
+  CHECK_NOT_NULL(inner);
+  CHECK_EQ(2, inner->count);
+  CHECK_GE(outer->retained_size, outer->self_size + inner->self_size);
+
+  // The number of classes and the retaining paths can be limited.
+  i::RetentionSummaryOptions options;
+  options.max_classes = 1;
+  options.max_retaining_path_length = 1;
+  result = i::TakeRetentionSummaryForTesting(isolate, options);
+  CHECK_EQ(1, result->classes.size());
+  CHECK_LE(result->classes[0].retaining_path.size(), 1);
+}
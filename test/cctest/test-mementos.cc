@@ -87,5 +87,67 @@ TEST(BadMementoAfterTopForceMinorGC) {
   i::heap::InvokeMinorGC(CcTest::heap());
 }
 
+TEST(PretenuringDecisionsDecayPerSite) {
+  v8_flags.allocation_site_pretenuring_decay = true;
+  v8_flags.allocation_site_pretenuring_decay_interval = 3;
+  CcTest::InitializeVM();
+  if (!i::v8_flags.allocation_site_pretenuring || v8_flags.single_generation)
+    return;
+  ManualGCScope manual_gc_scope;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  Handle<AllocationSite> first = isolate->factory()->NewAllocationSite(true);
+  Handle<AllocationSite> second = isolate->factory()->NewAllocationSite(true);
+  auto tenure_on_next_gc = [heap](Handle<AllocationSite> site) {
+    heap->pretenuring_handler()->PretenureAllocationSiteOnNextCollection(*site);
+  };
+  auto is_tenured = [](Handle<AllocationSite> site) {
+    return site->GetAllocationType() == AllocationType::kOld;
+  };
+
+  tenure_on_next_gc(first);
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(is_tenured(first));
+  CHECK(!is_tenured(second));
+
+  // Stale feedback of a site doesn't count towards its tenure age.
+  second->set_memento_found_count(2);
+  tenure_on_next_gc(second);
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(is_tenured(first));
+  CHECK(is_tenured(second));
+  CHECK_EQ(1, first->tenure_age());
+  CHECK_EQ(0, second->tenure_age());
+
+  // Requesting a tenured site to be pretenured again doesn't restart its age.
+  tenure_on_next_gc(first);
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(is_tenured(first));
+  CHECK(is_tenured(second));
+
+  // Each decision decays after surviving 3 full GCs, counted from the GC that
+  // made it, and not on a GC count shared by all sites.
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(!is_tenured(first));
+  CHECK(is_tenured(second));
+
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(!is_tenured(first));
+  CHECK(!is_tenured(second));
+
+  // A site that is tenured again keeps its decision twice as long.
+  tenure_on_next_gc(first);
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(is_tenured(first));
+  CHECK_EQ(2, first->tenure_history());
+  for (int i = 0; i < 5; i++) {
+    heap::InvokeAtomicMajorGC(heap);
+    CHECK(is_tenured(first));
+  }
+  heap::InvokeAtomicMajorGC(heap);
+  CHECK(!is_tenured(first));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -458,7 +458,7 @@ static void SerializeContext(base::Vector<const uint8_t>* startup_blob_out,
   v8_isolate->Dispose();
 }
 
-#ifdef SNAPSHOT_COMPRESSION
+#ifdef V8_SNAPSHOT_COMPRESSION
 UNINITIALIZED_TEST(SnapshotCompression) {
   DisableAlwaysOpt();
   base::Vector<const uint8_t> startup_blob;
@@ -468,18 +468,35 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   SerializeContext(&startup_blob, &read_only_blob, &shared_space_blob,
                    &context_blob);
   SnapshotData original_snapshot_data(context_blob);
-  SnapshotData compressed =
-      i::SnapshotCompression::Compress(&original_snapshot_data);
+  for (auto codec : {i::SnapshotCompression::Codec::kZlib,
+                     i::SnapshotCompression::Codec::kLz4}) {
+    SnapshotData compressed =
+        i::SnapshotCompression::Compress(&original_snapshot_data, codec);
+    CHECK_LT(compressed.RawData().size(), context_blob.size());
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(context_blob, decompressed.RawData());
+  }
+  // Data spanning several chunks is decompressed in parallel.
+  std::vector<uint8_t> large_blob;
+  while (large_blob.size() <= 3 * i::SnapshotCompression::kChunkSize) {
+    large_blob.insert(large_blob.end(), startup_blob.begin(),
+                      startup_blob.end());
+  }
+  base::Vector<const uint8_t> large_data(large_blob.data(), large_blob.size());
+  SnapshotData original_large_data(large_data);
+  SnapshotData compressed = i::SnapshotCompression::Compress(
+      &original_large_data, i::SnapshotCompression::Codec::kLz4);
   SnapshotData decompressed =
       i::SnapshotCompression::Decompress(compressed.RawData());
-  CHECK_EQ(context_blob, decompressed.RawData());
+  CHECK_EQ(large_data, decompressed.RawData());
 
   startup_blob.Dispose();
   read_only_blob.Dispose();
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
-#endif  // SNAPSHOT_COMPRESSION
+#endif  // V8_SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
@@ -942,6 +959,133 @@ UNINITIALIZED_TEST(SnapshotChecksum) {
   FreeCurrentEmbeddedBlob();
 }
 
+namespace {
+
+class DefaultSnapshotIsolateThread final : public v8::base::Thread {
+ public:
+  DefaultSnapshotIsolateThread()
+      : v8::base::Thread(base::Thread::Options("DefaultSnapshotIsolate")) {}
+
+  void Run() override {
+    v8::Isolate::CreateParams params;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      for (int i = 0; i < 2; i++) {
+        v8::Local<v8::Context> context = v8::Context::New(isolate);
+        v8::Context::Scope context_scope(context);
+        v8::Local<v8::Value> result =
+            CompileRun("[1, 2, 3].map(x => x * 2).join()");
+        CHECK(result->IsString());
+        CHECK(result.As<v8::String>()
+                  ->Equals(context, v8_str("2,4,6"))
+                  .FromJust());
+      }
+    }
+    isolate->Dispose();
+  }
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(DefaultSnapshotSharedBetweenIsolates) {
+  // Isolates created concurrently from the default snapshot share its
+  // verified checksum and decompressed sections.
+  i::v8_flags.share_snapshot_data = true;
+  i::v8_flags.verify_snapshot_checksum = true;
+  constexpr int kThreads = 4;
+  std::vector<std::unique_ptr<DefaultSnapshotIsolateThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    threads.push_back(std::make_unique<DefaultSnapshotIsolateThread>());
+    CHECK(threads.back()->Start());
+  }
+  for (auto& thread : threads) thread->Join();
+  // And so do isolates created after them.
+  DefaultSnapshotIsolateThread().Run();
+}
+
+UNINITIALIZED_TEST(SharedSnapshotDataIsKeyedByBlob) {
+  DisableAlwaysOpt();
+  v8::StartupData blob1 = CreateSnapshotDataBlob("var a = 1;");
+  v8::StartupData blob2 = CreateSnapshotDataBlob("var b = [1, 2, 3];");
+  CHECK_NE(Snapshot::GetExpectedChecksum(&blob1),
+           Snapshot::GetExpectedChecksum(&blob2));
+
+  // Both blobs live at the same address one after the other, like a default
+  // blob that is replaced by the embedder might.
+  int max_size = std::max(blob1.raw_size, blob2.raw_size);
+  std::unique_ptr<char[]> buffer(new char[max_size]);
+  v8::StartupData blob = {buffer.get(), blob1.raw_size};
+  MemCopy(buffer.get(), blob1.data, blob1.raw_size);
+
+  // The users are only used as keys, they are never dereferenced.
+  int users[3];
+  Isolate* user1 = reinterpret_cast<Isolate*>(&users[0]);
+  Isolate* user2 = reinterpret_cast<Isolate*>(&users[1]);
+  Isolate* user3 = reinterpret_cast<Isolate*>(&users[2]);
+
+  SharedSnapshotData shared;
+  CHECK(shared.Acquire(user1, &blob));
+  shared.SetChecksumVerified(user1);
+  CHECK(!shared.Acquire(user2, &blob));
+  CHECK_EQ(1u, shared.blob_count_for_testing());
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // A section at the same address, but with different contents for each blob.
+  std::vector<uint8_t> payload1(4 * KB, 'a');
+  std::vector<uint8_t> payload2(4 * KB, 'b');
+  SnapshotData data1(base::VectorOf(payload1));
+  SnapshotData data2(base::VectorOf(payload2));
+  SnapshotData compressed1 = SnapshotCompression::Compress(&data1);
+  SnapshotData compressed2 = SnapshotCompression::Compress(&data2);
+  std::vector<uint8_t> section(
+      std::max(compressed1.RawData().size(), compressed2.RawData().size()));
+  MemCopy(section.data(), compressed1.RawData().begin(),
+          compressed1.RawData().size());
+  base::Vector<const uint8_t> section1(section.data(),
+                                       compressed1.RawData().size());
+  CHECK_EQ(base::VectorOf(payload1), shared.Decompress(user1, section1));
+  // The second user of the same blob gets the same decompressed data.
+  CHECK_EQ(shared.Decompress(user1, section1).begin(),
+           shared.Decompress(user2, section1).begin());
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  // Replace the blob while it is still in use.
+  MemCopy(buffer.get(), blob2.data, blob2.raw_size);
+  blob.raw_size = blob2.raw_size;
+  CHECK(shared.Acquire(user3, &blob));
+  CHECK_EQ(2u, shared.blob_count_for_testing());
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // The new blob must not be served the data decompressed for the old one.
+  MemCopy(section.data(), compressed2.RawData().begin(),
+          compressed2.RawData().size());
+  base::Vector<const uint8_t> section2(section.data(),
+                                       compressed2.RawData().size());
+  CHECK_EQ(base::VectorOf(payload2), shared.Decompress(user3, section2));
+  CHECK_EQ(base::VectorOf(payload1), shared.Decompress(user1, section1));
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  // The data of a blob is freed with its last user, and its checksum has to
+  // be verified again afterwards.
+  shared.Release(user1);
+  CHECK_EQ(2u, shared.blob_count_for_testing());
+  shared.Release(user2);
+  CHECK_EQ(1u, shared.blob_count_for_testing());
+  shared.Release(user3);
+  CHECK_EQ(0u, shared.blob_count_for_testing());
+  CHECK(shared.Acquire(user1, &blob));
+  shared.Release(user1);
+  // Releasing unknown users is fine.
+  shared.Release(user2);
+  CHECK_EQ(0u, shared.blob_count_for_testing());
+
+  delete[] blob1.data;
+  delete[] blob2.data;
+}
+
 struct InternalFieldData {
   uint32_t data;
 };
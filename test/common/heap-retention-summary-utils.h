@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TEST_COMMON_HEAP_RETENTION_SUMMARY_UTILS_H_
+#define V8_TEST_COMMON_HEAP_RETENTION_SUMMARY_UTILS_H_
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-isolate.h"
+#include "src/execution/isolate.h"
+#include "src/init/v8.h"
+#include "src/profiler/heap-profiler.h"
+#include "src/profiler/heap-retention-summary.h"
+
+namespace v8 {
+namespace internal {
+
+// Takes a retention summary of |isolate|, and pumps the isolate's message loop
+// until the summary is delivered.
+inline std::unique_ptr<RetentionSummary> TakeRetentionSummaryForTesting(
+    v8::Isolate* isolate,
+    const RetentionSummaryOptions& options = RetentionSummaryOptions()) {
+  struct Result {
+    std::unique_ptr<RetentionSummary> summary;
+    bool done = false;
+  } result;
+  auto callback = [](std::unique_ptr<RetentionSummary> summary, void* data) {
+    Result* result = reinterpret_cast<Result*>(data);
+    result->summary = std::move(summary);
+    result->done = true;
+  };
+  reinterpret_cast<Isolate*>(isolate)->heap_profiler()->TakeRetentionSummary(
+      options, callback, &result);
+  // The summary is computed on a worker thread and delivered on the
+  // foreground task runner.
+  while (!result.done) {
+    v8::platform::PumpMessageLoop(
+        V8::GetCurrentPlatform(), isolate,
+        v8::platform::MessageLoopBehavior::kWaitForWork);
+  }
+  return std::move(result.summary);
+}
+
+inline const RetentionSummary::Class* FindRetentionSummaryClass(
+    const RetentionSummary& summary, const char* name, bool is_native = false) {
+  for (const RetentionSummary::Class& entry : summary.classes) {
+    if (entry.name == name && entry.is_native == is_native) return &entry;
+  }
+  return nullptr;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TEST_COMMON_HEAP_RETENTION_SUMMARY_UTILS_H_
@@ -0,0 +1,47 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --finalization-registry-cleanup-task-budget-ms=0.001
+
+(async function () {
+
+  let holdings_list = [];
+  let cleanup = function (holdings) {
+    holdings_list.push(holdings);
+  }
+
+  let fg1 = new FinalizationRegistry(cleanup);
+  let fg2 = new FinalizationRegistry(cleanup);
+  const kCount = 5;
+
+  (function () {
+    for (let i = 0; i < kCount; ++i) {
+      fg1.register({}, "a" + i, {});
+      fg2.register({}, "b" + i);
+    }
+  })();
+
+  // See multiple-dirty-finalization-groups.js for why GC is asynchronous.
+  await gc({ type: 'major', execution: 'async' });
+  assertEquals(0, holdings_list.length);
+
+  // The cleanup tasks run out of budget and requeue their FinalizationRegistry
+  // but eventually call the cleanup function for every holdings.
+  let tries = 0;
+  let timeout_func = function () {
+    if (holdings_list.length < 2 * kCount && ++tries < 100) {
+      setTimeout(timeout_func, 0);
+      return;
+    }
+    holdings_list.sort();
+    let expected = [];
+    for (let i = 0; i < kCount; ++i) expected.push("a" + i);
+    for (let i = 0; i < kCount; ++i) expected.push("b" + i);
+    assertEquals(expected, holdings_list);
+  }
+
+  setTimeout(timeout_func, 0);
+
+})();
@@ -0,0 +1,42 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings that don't fit into the current part of the result are copied in
+// runs between characters that need escaping.
+
+function escape(s) {
+  let result = '"';
+  for (const c of s) {
+    const code = c.charCodeAt(0);
+    if (c === '"') result += '\\"';
+    else if (c === '\\') result += '\\\\';
+    else if (c === '\n') result += '\\n';
+    else if (code < 0x20) {
+      result += '\\u' + code.toString(16).padStart(4, '0');
+    } else if (c.length === 1 && code >= 0xD800 && code <= 0xDFFF) {
+      result += '\\u' + code.toString(16);
+    } else {
+      result += c;
+    }
+  }
+  return result + '"';
+}
+
+const kLengths = [1000, 20000, 100000];
+const kPieces = ['a', 'xyz', '"', '\\', '\n', '\x01', '\xe9', '中',
+                 '😀', '\ud800', '\udc00'];
+
+for (const length of kLengths) {
+  for (const piece of kPieces) {
+    // Long runs of plain characters with a single special character.
+    const plain = 'a'.repeat(length);
+    const s = plain + piece + plain;
+    assertEquals(escape(s), JSON.stringify(s));
+    // Special characters spread over the whole string.
+    let mixed = '';
+    while (mixed.length < length) mixed += 'bcdefgh' + piece;
+    assertEquals(escape(mixed), JSON.stringify(mixed));
+    assertEquals(escape(mixed), JSON.stringify([mixed]).slice(1, -1));
+  }
+}
@@ -0,0 +1,72 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-dead-allocation-elimination
+
+// Dead object literal, only initialized and never read.
+(function() {
+  function f(x) {
+    let o = {a: x, b: 2.5, c: {d: x}};
+    return x + 1;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(1));
+  assertEquals(3, f(2));
+
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(4, f(3));
+  assertTrue(isMaglevved(f));
+})();
+
+// Dead array literal.
+(function() {
+  function f(x) {
+    let a = [x, x + 1, x + 2];
+    return x;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1));
+  assertEquals(2, f(2));
+
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(3, f(3));
+  assertTrue(isMaglevved(f));
+})();
+
+// Inner object is kept alive by a returned outer object.
+(function() {
+  function f(x) {
+    let inner = {v: x};
+    let outer = {inner: inner};
+    return outer;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1).inner.v);
+  assertEquals(2, f(2).inner.v);
+
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(3, f(3).inner.v);
+  assertTrue(isMaglevved(f));
+})();
+
+// Object is still live in the deopt frame state and must be kept.
+(function() {
+  function f(x) {
+    let o = {a: x};
+    let y = x + 1;
+    return o.a + y;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f(1));
+  assertEquals(5, f(2));
+
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(7, f(3));
+  assertTrue(isMaglevved(f));
+  assertEquals(4.5, f(1.75));
+})();
@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --maglev-pretenure-store-values --allocation-site-pretenuring
+// Flags: --stress-scavenge=0 --gc-interval=-1
+
+// Young allocations stored into a pretenured allocation are pretenured too.
+(function() {
+  function f(x) {
+    let table = {entry: null};
+    table.entry = {value: x};
+    return table;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  f(1);
+  f(2);
+  // Pretenure the outer literal's allocation site on the next GC.
+  assertTrue(%PretenureAllocationSite(f(3)));
+  gc();
+
+  %OptimizeMaglevOnNextCall(f);
+  let table = f(4);
+  assertTrue(isMaglevved(f));
+  assertEquals(4, table.entry.value);
+  assertFalse(%InYoungGeneration(table));
+  assertFalse(%InYoungGeneration(table.entry));
+})();
+
+// Values stored into young allocations are pretenured transitively once the
+// young allocation is stored into an old one.
+(function() {
+  function f(x) {
+    let table = {entry: null};
+    let entry = {inner: null};
+    entry.inner = {value: x};
+    table.entry = entry;
+    return table;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  f(1);
+  f(2);
+  assertTrue(%PretenureAllocationSite(f(3)));
+  gc();
+
+  %OptimizeMaglevOnNextCall(f);
+  let table = f(4);
+  assertTrue(isMaglevved(f));
+  assertEquals(4, table.entry.inner.value);
+  assertFalse(%InYoungGeneration(table.entry));
+  assertFalse(%InYoungGeneration(table.entry.inner));
+})();
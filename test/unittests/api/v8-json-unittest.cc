@@ -0,0 +1,112 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "include/v8-exception.h"
+#include "include/v8-json.h"
+#include "include/v8-primitive.h"
+#include "include/v8-value.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace {
+
+using JSONStreamingParserTest = TestWithContext;
+
+const char kDocument[] =
+    "{\"a\": [1, -0, 2.5e3, true, false, null, \"x\\\"y\\u0041\\n\"],\r\n"
+    " \"b\": {\"__proto__\": 1, \"0\": [], \"\": {}},\n"
+    " \"long string value\": \"\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80\","
+    " \"c\": -123456789012345678901234567890}";
+
+// Feeds |source| to a fresh parser in chunks of |chunk_size| bytes.
+MaybeLocal<Value> ParseInChunks(Local<Context> context, const char* source,
+                                size_t chunk_size) {
+  JSON::StreamingParser parser(context->GetIsolate());
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(source);
+  size_t length = strlen(source);
+  for (size_t offset = 0; offset < length; offset += chunk_size) {
+    size_t size = std::min(chunk_size, length - offset);
+    if (parser.Write(context, data + offset, size).IsNothing()) return {};
+  }
+  return parser.Finish(context);
+}
+
+std::string Stringify(Local<Context> context, Local<Value> value) {
+  Local<String> json = JSON::Stringify(context, value).ToLocalChecked();
+  return *String::Utf8Value(context->GetIsolate(), json);
+}
+
+TEST_F(JSONStreamingParserTest, MatchesJSONParse) {
+  HandleScope scope(isolate());
+  Local<String> source =
+      String::NewFromUtf8(isolate(), kDocument).ToLocalChecked();
+  std::string expected =
+      Stringify(context(), JSON::Parse(context(), source).ToLocalChecked());
+  // Chunk boundaries fall into every token and UTF-8 sequence at least once.
+  for (size_t chunk_size : {1, 2, 3, 5, 7, 64, 4096}) {
+    Local<Value> result =
+        ParseInChunks(context(), kDocument, chunk_size).ToLocalChecked();
+    EXPECT_EQ(expected, Stringify(context(), result));
+  }
+}
+
+TEST_F(JSONStreamingParserTest, Scalars) {
+  HandleScope scope(isolate());
+  Local<Value> result = ParseInChunks(context(), " 42 ", 1).ToLocalChecked();
+  EXPECT_EQ(42, result.As<Number>()->Value());
+  result = ParseInChunks(context(), "-0", 1).ToLocalChecked();
+  EXPECT_TRUE(std::signbit(result.As<Number>()->Value()));
+  result = ParseInChunks(context(), "\"\"", 1).ToLocalChecked();
+  EXPECT_EQ(0, result.As<String>()->Length());
+  result = ParseInChunks(context(), "null", 1).ToLocalChecked();
+  EXPECT_TRUE(result->IsNull());
+}
+
+TEST_F(JSONStreamingParserTest, InvalidUtf8IsReplaced) {
+  HandleScope scope(isolate());
+  Local<Value> result =
+      ParseInChunks(context(), "\"a\xE2\x82z\xFF\"", 1).ToLocalChecked();
+  EXPECT_EQ("a\xEF\xBF\xBDz\xEF\xBF\xBD",
+            std::string(*String::Utf8Value(isolate(), result)));
+}
+
+TEST_F(JSONStreamingParserTest, SyntaxError) {
+  HandleScope scope(isolate());
+  TryCatch try_catch(isolate());
+  JSON::StreamingParser parser(isolate());
+  const char* chunk = "[1,\n 2 3]";
+  EXPECT_TRUE(parser
+                  .Write(context(), reinterpret_cast<const uint8_t*>(chunk),
+                         strlen(chunk))
+                  .IsNothing());
+  ASSERT_TRUE(try_catch.HasCaught());
+  EXPECT_EQ(
+      "SyntaxError: Expected ',' or ']' after array element in JSON at "
+      "position 7 (line 2 column 4)",
+      std::string(*String::Utf8Value(isolate(), try_catch.Exception())));
+  try_catch.Reset();
+
+  // The parser stays in the error state.
+  EXPECT_TRUE(parser.Finish(context()).IsEmpty());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
+TEST_F(JSONStreamingParserTest, UnexpectedEndOfInput) {
+  HandleScope scope(isolate());
+  for (const char* source : {"", "[1, 2", "{\"a\":", "\"abc", "tru", "-"}) {
+    TryCatch try_catch(isolate());
+    EXPECT_TRUE(ParseInChunks(context(), source, 1).IsEmpty());
+    EXPECT_TRUE(try_catch.HasCaught());
+  }
+}
+
+}  // namespace
+}  // namespace v8
@@ -494,6 +494,40 @@ TEST_F(BytecodeAnalysisTest, SuspendPoint) {
   EnsureLivenessMatches(bytecode, expected_liveness);
 }
 
+TEST_F(BytecodeAnalysisTest, CacheSharesAnalysesUntilFullGC) {
+  interpreter::BytecodeArrayBuilder builder(zone(), 3, 3);
+  builder.LoadAccumulatorWithRegister(interpreter::Register(0)).Return();
+  Handle<BytecodeArray> bytecode = builder.ToBytecodeArray(isolate());
+
+  BytecodeAnalysisCache cache(isolate()->allocator());
+  std::shared_ptr<const BytecodeAnalysis> analysis =
+      cache.Get(bytecode, BytecodeOffset::None(), true, 0);
+  EXPECT_TRUE(analysis->liveness_analyzed());
+  EXPECT_EQ(analysis, cache.Get(bytecode, BytecodeOffset::None(), true, 0));
+  EXPECT_EQ(1u, cache.size_for_testing());
+
+  // An analysis without liveness doesn't subsume one with it, and replaces it
+  // in the cache.
+  std::shared_ptr<const BytecodeAnalysis> without_liveness =
+      cache.Get(bytecode, BytecodeOffset::None(), false, 0);
+  EXPECT_NE(analysis, without_liveness);
+  EXPECT_FALSE(without_liveness->liveness_analyzed());
+  EXPECT_EQ(without_liveness,
+            cache.Get(bytecode, BytecodeOffset::None(), false, 0));
+  EXPECT_EQ(1u, cache.size_for_testing());
+  // The replaced analysis stays usable as long as it is referenced.
+  EXPECT_NE(nullptr, analysis->GetInLivenessFor(0));
+
+  // A full GC may have moved the bytecode array, so the analyses are dropped.
+  std::shared_ptr<const BytecodeAnalysis> after_gc =
+      cache.Get(bytecode, BytecodeOffset::None(), false, 1);
+  EXPECT_NE(without_liveness, after_gc);
+  EXPECT_EQ(1u, cache.size_for_testing());
+  // Analyses from before the GC are not cached anymore.
+  EXPECT_NE(after_gc, cache.Get(bytecode, BytecodeOffset::None(), false, 0));
+  EXPECT_EQ(after_gc, cache.Get(bytecode, BytecodeOffset::None(), false, 1));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <cstring>
+#include <limits>
 
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/common.h"
@@ -22,6 +23,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/heap-snapshot-generator.h"
+#include "test/common/heap-retention-summary-utils.h"
 #include "test/unittests/heap/cppgc-js/unified-heap-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 
@@ -648,5 +650,83 @@ TEST_F(UnifiedHeapSnapshotTest, TriggerDetachednessCallbackSettingDetached) {
       });
 }
 
+namespace {
+
+class WrappableWithChild final : public GCedWithJSRef,
+                                 public cppgc::NameProvider {
+ public:
+  static constexpr const char kExpectedName[] = "WrappableWithChild";
+
+  void Trace(cppgc::Visitor* v) const final {
+    GCedWithJSRef::Trace(v);
+    v->Trace(child);
+  }
+  const char* GetHumanReadableName() const final { return kExpectedName; }
+
+  cppgc::Member<GCed> child;
+};
+// static
+constexpr const char WrappableWithChild::kExpectedName[];
+
+}  // namespace
+
+TEST_F(UnifiedHeapSnapshotTest, RetentionSummaryOfObjectsRetainedByWrapper) {
+  // Test ensures that C++ objects that are only reachable through a JS wrapper
+  // are retained by the wrapper in the retention summary. The wrapper is
+  // merged with its wrappable.
+  static constexpr size_t kChainLength = 16;
+  JsTestingScope testing_scope(v8_isolate());
+  WrappableWithChild* wrappable =
+      cppgc::MakeGarbageCollected<WrappableWithChild>(allocation_handle());
+  v8::Local<v8::Object> wrapper_object = WrapperHelper::CreateWrapper(
+      testing_scope.context(), &GCedWithJSRef::kWrappableType, wrappable,
+      "CppWrapper");
+  wrappable->SetV8Object(v8_isolate(), wrapper_object);
+  wrappable->SetWrapperClassId(1);  // Any class id will do.
+  wrappable->child = cppgc::MakeGarbageCollected<GCed>(allocation_handle());
+  BaseWithoutName* last = wrappable->child.Get();
+  for (size_t i = 1; i < kChainLength; ++i) {
+    GCed* next = cppgc::MakeGarbageCollected<GCed>(allocation_handle());
+    last->next = next;
+    last = next;
+  }
+  testing_scope.context()
+      ->Global()
+      ->Set(testing_scope.context(),
+            v8::String::NewFromUtf8(v8_isolate(), "wrapper").ToLocalChecked(),
+            wrapper_object)
+      .ToChecked();
+
+  RetentionSummaryOptions options;
+  // The C++ objects must only be found through the wrapper.
+  options.stack_state = cppgc::EmbedderStackState::kNoHeapPointers;
+  // The C++ objects are small compared to the JS builtins.
+  options.max_classes = std::numeric_limits<size_t>::max();
+  std::unique_ptr<RetentionSummary> result =
+      TakeRetentionSummaryForTesting(v8_isolate(), options);
+  const RetentionSummary& summary = *result;
+
+  const RetentionSummary::Class* gced =
+      FindRetentionSummaryClass(summary, GCed::kExpectedName, true);
+  ASSERT_NE(nullptr, gced);
+  EXPECT_EQ(kChainLength, gced->count);
+  EXPECT_GT(gced->self_size, 0u);
+  // The first object of the chain retains all the others.
+  EXPECT_EQ(gced->self_size, gced->retained_size);
+  ASSERT_FALSE(gced->retaining_path.empty());
+  EXPECT_EQ(WrappableWithChild::kExpectedName, gced->retaining_path[0]);
+
+  const RetentionSummary::Class* wrapper =
+      FindRetentionSummaryClass(summary, WrappableWithChild::kExpectedName,
+                                true);
+  ASSERT_NE(nullptr, wrapper);
+  EXPECT_EQ(1u, wrapper->count);
+  // The merged node accounts for the wrapper and, if C++ object sizes are
+  // known, the wrappable.
+  EXPECT_GE(wrapper->self_size,
+            static_cast<size_t>(Utils::OpenHandle(*wrapper_object)->Size()));
+  EXPECT_GE(wrapper->retained_size, wrapper->self_size + gced->self_size);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -23,6 +23,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class OtherCompactableCustomSpace
+    : public CustomSpace<OtherCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -43,6 +50,58 @@ struct CompactableGCed : public GarbageCollected<CompactableGCed> {
 // static
 size_t CompactableGCed::g_destructor_callcount = 0;
 
+// Same as CompactableGCed, but allocated on another compactable space.
+struct OtherCompactableGCed : public GarbageCollected<OtherCompactableGCed> {
+ public:
+  ~OtherCompactableGCed() { ++CompactableGCed::g_destructor_callcount; }
+  void Trace(Visitor* visitor) const {
+    VisitorBase::TraceRawForTesting(visitor,
+                                    const_cast<const CompactableGCed*>(other));
+    visitor->RegisterMovableReference(
+        const_cast<const CompactableGCed**>(&other));
+  }
+  CompactableGCed* other = nullptr;
+};
+
+// Larger than CompactableGCed, so that a few thousand objects span enough
+// pages to be compacted in parallel.
+struct LargeCompactableGCed : public GarbageCollected<LargeCompactableGCed> {
+ public:
+  ~LargeCompactableGCed() { ++CompactableGCed::g_destructor_callcount; }
+  void Trace(Visitor* visitor) const {
+    VisitorBase::TraceRawForTesting(
+        visitor, const_cast<const LargeCompactableGCed*>(other));
+    visitor->RegisterMovableReference(
+        const_cast<const LargeCompactableGCed**>(&other));
+  }
+  LargeCompactableGCed* other = nullptr;
+  size_t id = 0;
+  char padding[1024];
+};
+
+template <int kNumObjects>
+struct LargeCompactableHolder
+    : public GarbageCollected<LargeCompactableHolder<kNumObjects>> {
+ public:
+  explicit LargeCompactableHolder(cppgc::AllocationHandle& allocation_handle) {
+    for (int i = 0; i < kNumObjects; ++i) {
+      objects[i] =
+          MakeGarbageCollected<LargeCompactableGCed>(allocation_handle);
+      objects[i]->id = i;
+    }
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (int i = 0; i < kNumObjects; ++i) {
+      VisitorBase::TraceRawForTesting(
+          visitor, const_cast<const LargeCompactableGCed*>(objects[i]));
+      visitor->RegisterMovableReference(
+          const_cast<const LargeCompactableGCed**>(&objects[i]));
+    }
+  }
+  LargeCompactableGCed* objects[kNumObjects]{};
+};
+
 template <int kNumObjects>
 struct CompactableHolder
     : public GarbageCollected<CompactableHolder<kNumObjects>> {
@@ -63,12 +122,35 @@ struct CompactableHolder
   CompactableGCed* objects[kNumObjects]{};
 };
 
+template <int kNumObjects>
+struct OtherCompactableHolder
+    : public GarbageCollected<OtherCompactableHolder<kNumObjects>> {
+ public:
+  explicit OtherCompactableHolder(cppgc::AllocationHandle& allocation_handle) {
+    for (int i = 0; i < kNumObjects; ++i)
+      objects[i] =
+          MakeGarbageCollected<OtherCompactableGCed>(allocation_handle);
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (int i = 0; i < kNumObjects; ++i) {
+      VisitorBase::TraceRawForTesting(
+          visitor, const_cast<const OtherCompactableGCed*>(objects[i]));
+      visitor->RegisterMovableReference(
+          const_cast<const OtherCompactableGCed**>(&objects[i]));
+    }
+  }
+  OtherCompactableGCed* objects[kNumObjects]{};
+};
+
 class CompactorTest : public testing::TestWithPlatform {
  public:
   CompactorTest() {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<OtherCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -119,6 +201,16 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::OtherCompactableGCed> {
+  using Space = OtherCompactableCustomSpace;
+};
+
+template <>
+struct SpaceTrait<internal::LargeCompactableGCed> {
+  using Space = CompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -245,5 +337,91 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, IndependentSpacesHalfLive) {
+  static constexpr int kNumObjects = 10;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<OtherCompactableHolder<kNumObjects>> other_holder =
+      MakeGarbageCollected<OtherCompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  OtherCompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    other_references[i] = other_holder->objects[i];
+  }
+  StartGC();
+  for (int i = 0; i < kNumObjects; i += 2) {
+    holder->objects[i] = nullptr;
+    other_holder->objects[i] = nullptr;
+  }
+  EndGC();
+  EXPECT_EQ(10u, CompactableGCed::g_destructor_callcount);
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(holder->objects[i], references[i / 2]);
+    EXPECT_EQ(other_holder->objects[i], other_references[i / 2]);
+  }
+}
+
+TEST_F(CompactorTest, InteriorSlotToOtherSpace) {
+  static constexpr int kNumObjects = 3;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<OtherCompactableHolder<kNumObjects>> other_holder =
+      MakeGarbageCollected<OtherCompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  OtherCompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    other_references[i] = other_holder->objects[i];
+  }
+  // The slot in the other space refers to an object that may be moved by
+  // another thread.
+  other_holder->objects[2]->other = holder->objects[2];
+  holder->objects[2] = nullptr;
+  holder->objects[0] = nullptr;
+  other_holder->objects[0] = nullptr;
+  StartGC();
+  EndGC();
+  EXPECT_EQ(2u, CompactableGCed::g_destructor_callcount);
+  EXPECT_EQ(references[0], holder->objects[1]);
+  EXPECT_EQ(other_references[0], other_holder->objects[1]);
+  EXPECT_EQ(other_references[1], other_holder->objects[2]);
+  EXPECT_EQ(references[1], other_holder->objects[2]->other);
+}
+
+TEST_F(CompactorTest, InteriorSlotsAcrossPagesOfSpace) {
+  // Spans more pages than are compacted by a single thread.
+  static constexpr int kNumObjects = 4096;
+  static constexpr int kHalf = kNumObjects / 2;
+  Persistent<LargeCompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<LargeCompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  LargeCompactableGCed* first_object = holder->objects[0];
+  // Objects in the second half are only referred to from interior slots of
+  // objects in the first half, which live on different pages.
+  for (int i = 0; i < kHalf; ++i) {
+    holder->objects[i]->other = holder->objects[i + kHalf];
+    holder->objects[i + kHalf] = nullptr;
+  }
+  for (int i = 0; i < kHalf; i += 2) {
+    holder->objects[i] = nullptr;
+  }
+  StartGC();
+  EndGC();
+  EXPECT_EQ(static_cast<size_t>(kHalf),
+            CompactableGCed::g_destructor_callcount);
+  EXPECT_EQ(first_object, holder->objects[1]);
+  for (int i = 1; i < kHalf; i += 2) {
+    ASSERT_NE(nullptr, holder->objects[i]);
+    EXPECT_EQ(static_cast<size_t>(i), holder->objects[i]->id);
+    ASSERT_NE(nullptr, holder->objects[i]->other);
+    EXPECT_EQ(static_cast<size_t>(i + kHalf), holder->objects[i]->other->id);
+  }
+}
+
 }  // namespace internal
 }  // namespace cppgc
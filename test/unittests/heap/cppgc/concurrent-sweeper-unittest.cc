@@ -68,7 +68,8 @@ class ConcurrentSweeperTest : public testing::TestWithHeap {
  public:
   ConcurrentSweeperTest() { g_destructor_callcount = 0; }
 
-  void StartSweeping() {
+  void StartSweeping(SweepingConfig::LazySweeping lazy_sweeping =
+                         SweepingConfig::LazySweeping::kDisabled) {
     Heap* heap = Heap::From(GetHeap());
     ResetLinearAllocationBuffers();
     // Pretend do finish marking as StatsCollector verifies that Notify*
@@ -80,7 +81,8 @@ class ConcurrentSweeperTest : public testing::TestWithHeap {
     Sweeper& sweeper = heap->sweeper();
     const SweepingConfig sweeping_config{
         SweepingConfig::SweepingType::kIncrementalAndConcurrent,
-        SweepingConfig::CompactableSpaceHandling::kSweep};
+        SweepingConfig::CompactableSpaceHandling::kSweep,
+        SweepingConfig::FreeMemoryHandling::kDoNotDiscard, lazy_sweeping};
     sweeper.Start(sweeping_config);
   }
 
@@ -356,6 +358,74 @@ TEST_F(ConcurrentSweeperTest, IncrementalSweeping) {
   FinishSweeping();
 }
 
+TEST_F(ConcurrentSweeperTest, LazySweepingInIdleTime) {
+  testing::TestPlatform::DisableBackgroundTasksScope disable_concurrent_sweeper(
+      &GetPlatform());
+
+  MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  MakeGarbageCollected<LargeFinalizable>(GetAllocationHandle());
+
+  StartSweeping(SweepingConfig::LazySweeping::kEnabled);
+  Sweeper& sweeper = Heap::From(GetHeap())->sweeper();
+  EXPECT_EQ(0u, g_destructor_callcount);
+  EXPECT_TRUE(sweeper.IsSweepingInProgress());
+
+  // Without idle time, nothing is swept.
+  GetPlatform().RunAllNonIdleForegroundTasks();
+  EXPECT_EQ(0u, g_destructor_callcount);
+  EXPECT_TRUE(sweeper.IsSweepingInProgress());
+
+  // Runs idle tasks with an unlimited deadline.
+  GetPlatform().RunAllForegroundTasks();
+
+  EXPECT_EQ(2u, g_destructor_callcount);
+  EXPECT_FALSE(sweeper.IsSweepingInProgress());
+}
+
+TEST_F(ConcurrentSweeperTest, LazySweepingKeepsFinalizersWhenOutOfWork) {
+  static constexpr size_t kNumberOfObjects = 10;
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  }
+
+  StartSweeping(SweepingConfig::LazySweeping::kEnabled);
+  WaitForConcurrentSweeping();
+  // The concurrent sweeper leaves the finalizers to the mutator thread, where
+  // they are not run eagerly once the concurrent sweeper is done.
+  Sweeper& sweeper = Heap::From(GetHeap())->sweeper();
+  sweeper.FinishIfOutOfWork();
+  EXPECT_EQ(0u, g_destructor_callcount);
+  EXPECT_TRUE(sweeper.IsSweepingInProgress());
+
+  FinishSweeping();
+  EXPECT_EQ(kNumberOfObjects, g_destructor_callcount);
+}
+
+TEST_F(ConcurrentSweeperTest, LazySweepingOnAllocation) {
+  testing::TestPlatform::DisableBackgroundTasksScope disable_concurrent_sweeper(
+      &GetPlatform());
+
+  static constexpr size_t kNumberOfObjects = 10;
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  }
+
+  StartSweeping(SweepingConfig::LazySweeping::kEnabled);
+  EXPECT_EQ(0u, g_destructor_callcount);
+
+  // The space has no free memory left, so allocation sweeps the page first.
+  MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  EXPECT_EQ(kNumberOfObjects, g_destructor_callcount);
+
+  FinishSweeping();
+
+  const StatsCollector::Event& event =
+      Heap::From(GetHeap())->stats_collector()->GetPreviousEventForTesting();
+  EXPECT_EQ(1u, event.sweep_on_allocation_steps);
+  EXPECT_LE(event.sweep_on_allocation_time,
+            event.scope_data[StatsCollector::kIncrementalSweep]);
+}
+
 TEST_F(ConcurrentSweeperTest, SweepOnAllocationReturnEmptyPage) {
   PreciseGC();
 
@@ -183,5 +183,29 @@ TEST(FreeListTest, Allocate) {
   EXPECT_EQ(0u, empty_block.size);
 }
 
+TEST(FreeListTest, AllocateScansFinalBucket) {
+  // All blocks end up in the same bucket. Entries are added to the head, so
+  // the fitting block is the last one in the bucket.
+  std::vector<Block> blocks;
+  blocks.emplace_back(96);
+  blocks.emplace_back(64);
+  blocks.emplace_back(72);
+
+  FreeList list = CreatePopulatedFreeList(blocks);
+
+  const auto result = list.Allocate(80);
+  EXPECT_EQ(blocks[0].Address(), result.address);
+  EXPECT_EQ(96u, result.size);
+  EXPECT_EQ(64u + 72u, list.Size());
+
+  // The remaining entries are still linked properly.
+  const auto other = list.Allocate(72);
+  EXPECT_EQ(blocks[2].Address(), other.address);
+  EXPECT_EQ(64u, list.Size());
+  list.Add({blocks[0].Address(), blocks[0].Size()});
+  EXPECT_EQ(64u + 96u, list.Size());
+  EXPECT_TRUE(list.ContainsForTesting({blocks[0].Address(), 96u}));
+}
+
 }  // namespace internal
 }  // namespace cppgc
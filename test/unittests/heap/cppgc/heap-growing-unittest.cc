@@ -23,7 +23,7 @@ class FakeGarbageCollector : public GarbageCollector {
   void SetLiveBytes(size_t live_bytes) { live_bytes_ = live_bytes; }
 
   void CollectGarbage(GCConfig config) override {
-    stats_collector_->NotifyMarkingStarted(CollectionType::kMajor,
+    stats_collector_->NotifyMarkingStarted(config.collection_type,
                                            GCConfig::MarkingType::kAtomic,
                                            GCConfig::IsForcedGC::kNotForced);
     stats_collector_->NotifyMarkingCompleted(live_bytes_);
@@ -172,5 +172,70 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+TEST(HeapGrowingTest, MinorGCInvoked) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes =
+      10 * HeapGrowing::kMaxYoungGenerationSize;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_EQ(SIZE_MAX, growing.limit_for_minor_gc());
+  growing.EnableMinorGCs();
+  EXPECT_EQ(HeapGrowing::kMinYoungGenerationSize,
+            growing.limit_for_minor_gc());
+  EXPECT_CALL(gc, CollectGarbage(::testing::_)).Times(0);
+  FakeAllocate(&stats_collector, HeapGrowing::kMinYoungGenerationSize);
+  ::testing::Mock::VerifyAndClearExpectations(&gc);
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(&GCConfig::collection_type,
+                                                  CollectionType::kMinor)));
+  FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
+}
+
+TEST(HeapGrowingTest, MinorGCKeepsMajorGCLimit) {
+  StatsCollector stats_collector(kNoPlatform);
+  FakeGarbageCollector gc(&stats_collector);
+  cppgc::Heap::ResourceConstraints constraints;
+  // Small enough for the young objects surviving the minor GC below to
+  // exceed it, so that configuring the limit from them would raise it.
+  constraints.initial_heap_size_bytes =
+      HeapGrowing::kMinYoungGenerationSize / 2;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kAtomic,
+                      cppgc::Heap::SweepingType::kAtomic);
+  growing.EnableMinorGCs();
+  const size_t limit_for_atomic_gc = growing.limit_for_atomic_gc();
+  constexpr size_t kAllocatedBytes = HeapGrowing::kMinYoungGenerationSize + 1;
+  ASSERT_LT(kAllocatedBytes, limit_for_atomic_gc);
+  ASSERT_GT(kAllocatedBytes, constraints.initial_heap_size_bytes);
+  // All young objects survive.
+  gc.SetLiveBytes(kAllocatedBytes);
+  FakeAllocate(&stats_collector, kAllocatedBytes);
+  EXPECT_EQ(1u, gc.epoch());
+  EXPECT_EQ(limit_for_atomic_gc, growing.limit_for_atomic_gc());
+  EXPECT_LT(limit_for_atomic_gc,
+            static_cast<size_t>(kAllocatedBytes * HeapGrowing::kGrowingFactor));
+}
+
+TEST(HeapGrowingTest, YoungGenerationGrowsWithHighSurvivalRate) {
+  StatsCollector stats_collector(kNoPlatform);
+  FakeGarbageCollector gc(&stats_collector);
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes =
+      10 * HeapGrowing::kMaxYoungGenerationSize;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  growing.EnableMinorGCs();
+  // All young objects survive.
+  constexpr size_t kAllocatedBytes = HeapGrowing::kMinYoungGenerationSize + 1;
+  gc.SetLiveBytes(kAllocatedBytes);
+  FakeAllocate(&stats_collector, kAllocatedBytes);
+  EXPECT_EQ(1u, gc.epoch());
+  EXPECT_EQ(kAllocatedBytes + 2 * HeapGrowing::kMinYoungGenerationSize,
+            growing.limit_for_minor_gc());
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -80,12 +80,19 @@ TEST_F(PageTest, PredefinedSpaces) {
     EXPECT_EQ(3u, space.index());
     EXPECT_FALSE(space.is_large());
   }
+  {
+    auto* gced = MakeGarbageCollected<GCed<512>>(GetAllocationHandle());
+    BaseSpace& space = NormalPage::FromPayload(gced)->space();
+    EXPECT_EQ(heap.Space(SpaceType::kNormal5), &space);
+    EXPECT_EQ(4u, space.index());
+    EXPECT_FALSE(space.is_large());
+  }
   {
     auto* gced = MakeGarbageCollected<GCed<2 * kLargeObjectSizeThreshold>>(
         GetAllocationHandle());
     BaseSpace& space = NormalPage::FromPayload(gced)->space();
     EXPECT_EQ(heap.Space(SpaceType::kLarge), &space);
-    EXPECT_EQ(4u, space.index());
+    EXPECT_EQ(5u, space.index());
     EXPECT_TRUE(space.is_large());
   }
 }
@@ -24,14 +24,18 @@ std::unique_ptr<cppgc::JobHandle> TestPlatform::PostJob(
 }
 
 void TestPlatform::RunAllForegroundTasks() {
-  while (v8::platform::PumpMessageLoop(v8_platform_.get(), kNoIsolate)) {
-  }
+  RunAllNonIdleForegroundTasks();
   if (GetForegroundTaskRunner()->IdleTasksEnabled()) {
     v8::platform::RunIdleTasks(v8_platform_.get(), kNoIsolate,
                                std::numeric_limits<double>::max());
   }
 }
 
+void TestPlatform::RunAllNonIdleForegroundTasks() {
+  while (v8::platform::PumpMessageLoop(v8_platform_.get(), kNoIsolate)) {
+  }
+}
+
 TestPlatform::DisableBackgroundTasksScope::DisableBackgroundTasksScope(
     TestPlatform* platform)
     : platform_(platform) {
@@ -31,6 +31,8 @@ class TestPlatform : public DefaultPlatform {
       std::unique_ptr<cppgc::JobTask> job_task) final;
 
   void RunAllForegroundTasks();
+  // Runs regular foreground tasks, but no idle tasks.
+  void RunAllNonIdleForegroundTasks();
 
  private:
   bool AreBackgroundTasksDisabled() const {
@@ -227,6 +227,28 @@ TEST_F(GCTracerTest, RegularScope) {
             tracer->current_.scopes[GCTracer::Scope::MC_MARK]);
 }
 
+TEST_F(GCTracerTest, ClearedWeakReferences) {
+  if (v8_flags.stress_incremental_marking) return;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  StartTracing(tracer, GarbageCollector::MARK_COMPACTOR,
+               StartTracingMode::kAtomic);
+  tracer->RecordClearedWeakReferences(2, 3);
+  tracer->RecordClearedWeakReferences(1, 0);
+  StopTracing(tracer, GarbageCollector::MARK_COMPACTOR);
+  EXPECT_EQ(3u, tracer->current_.cleared_js_weak_refs);
+  EXPECT_EQ(3u, tracer->current_.cleared_weak_cells);
+
+  // Counters are per cycle.
+  StartTracing(tracer, GarbageCollector::MARK_COMPACTOR,
+               StartTracingMode::kAtomic);
+  tracer->RecordClearedWeakReferences(0, 1);
+  StopTracing(tracer, GarbageCollector::MARK_COMPACTOR);
+  EXPECT_EQ(0u, tracer->current_.cleared_js_weak_refs);
+  EXPECT_EQ(1u, tracer->current_.cleared_weak_cells);
+}
+
 TEST_F(GCTracerTest, IncrementalScope) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
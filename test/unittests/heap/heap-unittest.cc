@@ -231,7 +231,7 @@ void ShrinkNewSpace(NewSpace* new_space) {
                      GarbageCollectionReason::kTesting, "heap unittest",
                      GCTracer::MarkingType::kAtomic);
   tracer->StartAtomicPause();
-  paged_new_space->StartShrinking();
+  paged_new_space->StartShrinking(0);
   for (auto it = paged_new_space->begin();
        it != paged_new_space->end() &&
        (paged_new_space->ShouldReleaseEmptyPage());) {
@@ -450,6 +450,48 @@ TEST_F(HeapTest, RememberedSet_InsertOnPromotingObjectToOld) {
   }
 }
 
+TEST_F(HeapTest, RememberedSet_ScavengeLargePageInRanges) {
+  if (v8_flags.single_generation || v8_flags.minor_ms) return;
+  if (v8_flags.stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope(isolate());
+  Factory* factory = isolate()->factory();
+  Heap* heap = isolate()->heap();
+  HandleScope scope(isolate());
+
+  // The slot set of the array's large page spans several scavenger work items
+  // of 64 buckets each, with a partial range at the end.
+  const int kSlotsPerBucket = SlotSet::kBitsPerBucket;
+  const int kLength = 4 * 64 * kSlotsPerBucket + kSlotsPerBucket / 2;
+  Handle<FixedArray> arr =
+      factory->NewFixedArray(kLength, AllocationType::kOld);
+  MemoryChunk* chunk = MemoryChunk::FromHeapObject(*arr);
+  CHECK(chunk->IsLargePage());
+  CHECK_GT(chunk->buckets(), 4u * 64u);
+
+  // Store a young object into every bucket of the array.
+  for (int i = 0; i < kLength; i += kSlotsPerBucket / 2) {
+    HandleScope scope_inner(isolate());
+    Handle<Object> number = factory->NewHeapNumber(i);
+    arr->set(i, *number);
+  }
+  CHECK_NOT_NULL(chunk->slot_set<OLD_TO_NEW>());
+
+  // Two scavenges promote all elements. Every range of the page must find its
+  // slots, and once they are all gone, the empty buckets of all ranges must
+  // be released together with the slot set.
+  InvokeAtomicMinorGC();
+  InvokeAtomicMinorGC();
+  heap->EnsureSweepingCompleted(Heap::SweepingForcedFinalizationMode::kV8Only);
+
+  for (int i = 0; i < kLength; i += kSlotsPerBucket / 2) {
+    Tagged<Object> element = arr->get(i);
+    CHECK(IsHeapNumber(element));
+    CHECK_EQ(i, HeapNumber::cast(element)->value());
+    CHECK(!Heap::InYoungGeneration(element));
+  }
+  CHECK_NULL(chunk->slot_set<OLD_TO_NEW>());
+}
+
 TEST_F(HeapTest, Regress978156) {
   if (!v8_flags.incremental_marking) return;
   if (v8_flags.single_generation) return;
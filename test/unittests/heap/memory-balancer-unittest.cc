@@ -0,0 +1,83 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/memory-balancer.h"
+
+#include "src/execution/isolate.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+using MemoryBalancerTest = TestWithIsolate;
+
+namespace {
+
+constexpr double kEpsilonMs = 0.01;
+
+base::TimeDelta Ms(int ms) { return base::TimeDelta::FromMilliseconds(ms); }
+
+}  // namespace
+
+TEST_F(MemoryBalancerTest, PauseTargetWindow) {
+  FLAG_SCOPE(gc_pause_target);
+  FlagScope<double> utilization(&v8_flags.gc_mutator_utilization, 0.9);
+  FlagScope<int> window(&v8_flags.gc_mutator_utilization_window_ms, 100);
+  EXPECT_NEAR(10, MemoryBalancer::PauseBudget().InMillisecondsF(), kEpsilonMs);
+
+  MemoryBalancer mb(i_isolate()->heap(), base::TimeTicks::Now());
+  const base::TimeTicks start = base::TimeTicks::Now();
+  EXPECT_NEAR(10, mb.RemainingPauseBudget(start).InMillisecondsF(),
+              kEpsilonMs);
+
+  mb.RecordMainThreadPause(start + Ms(50), Ms(4));
+  EXPECT_NEAR(6, mb.RemainingPauseBudget(start + Ms(50)).InMillisecondsF(),
+              kEpsilonMs);
+  mb.RecordMainThreadPause(start + Ms(60), Ms(4));
+  EXPECT_NEAR(2, mb.RemainingPauseBudget(start + Ms(60)).InMillisecondsF(),
+              kEpsilonMs);
+
+  // The first pause left the window, the second one only partially.
+  EXPECT_NEAR(6, mb.RemainingPauseBudget(start + Ms(152)).InMillisecondsF(),
+              kEpsilonMs);
+  EXPECT_NEAR(8, mb.RemainingPauseBudget(start + Ms(158)).InMillisecondsF(),
+              kEpsilonMs);
+
+  // A pause longer than the budget misses the target and exhausts the budget.
+  mb.RecordMainThreadPause(start + Ms(170), Ms(12));
+  EXPECT_EQ(base::TimeDelta(), mb.RemainingPauseBudget(start + Ms(170)));
+
+  v8::metrics::GarbageCollectionMutatorUtilization event =
+      mb.ExtractMutatorUtilizationEvent();
+  EXPECT_NEAR(90, event.target_in_percent, kEpsilonMs);
+  EXPECT_NEAR(88, event.minimum_in_percent, kEpsilonMs);
+  EXPECT_EQ(1, event.windows_below_target);
+
+  // Extracting the event resets the statistics.
+  event = mb.ExtractMutatorUtilizationEvent();
+  EXPECT_NEAR(100, event.minimum_in_percent, kEpsilonMs);
+  EXPECT_EQ(0, event.windows_below_target);
+}
+
+TEST_F(MemoryBalancerTest, MutatorUtilizationIsClamped) {
+  FLAG_SCOPE(gc_pause_target);
+  FlagScope<int> window(&v8_flags.gc_mutator_utilization_window_ms, 100);
+  {
+    // A target of 100% would leave no pause budget at all, and an infinite
+    // heap limit.
+    FlagScope<double> utilization(&v8_flags.gc_mutator_utilization, 1.0);
+    EXPECT_NEAR(1, MemoryBalancer::PauseBudget().InMillisecondsF(),
+                kEpsilonMs);
+    EXPECT_LT(MemoryBalancer::MutatorUtilizationTarget(), 1.0);
+  }
+  {
+    FlagScope<double> utilization(&v8_flags.gc_mutator_utilization, -0.5);
+    EXPECT_NEAR(100, MemoryBalancer::PauseBudget().InMillisecondsF(),
+                kEpsilonMs);
+    EXPECT_EQ(0.0, MemoryBalancer::MutatorUtilizationTarget());
+  }
+}
+
+}  // namespace v8::internal
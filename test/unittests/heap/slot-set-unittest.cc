@@ -59,6 +59,22 @@ TEST(PossiblyEmptyBuckets, ContainsAndInsert) {
   EXPECT_TRUE(possibly_empty_buckets.Contains(last + 1));
 }
 
+TEST(PossiblyEmptyBuckets, EnsureAllocated) {
+  static const int kBuckets = 4 * PossiblyEmptyBuckets::kBucketsPerWord;
+  PossiblyEmptyBuckets possibly_empty_buckets;
+  possibly_empty_buckets.Insert(1, kBuckets);
+  possibly_empty_buckets.EnsureAllocated(kBuckets);
+  EXPECT_FALSE(possibly_empty_buckets.IsEmpty());
+  EXPECT_TRUE(possibly_empty_buckets.Contains(1));
+  // Allocating again keeps the already recorded buckets.
+  possibly_empty_buckets.EnsureAllocated(kBuckets);
+  EXPECT_TRUE(possibly_empty_buckets.Contains(1));
+  possibly_empty_buckets.Insert(kBuckets - 1, kBuckets);
+  EXPECT_TRUE(possibly_empty_buckets.Contains(kBuckets - 1));
+  EXPECT_FALSE(possibly_empty_buckets.Contains(0));
+  EXPECT_FALSE(possibly_empty_buckets.Contains(kBuckets - 2));
+}
+
 TEST(TypedSlotSet, Iterate) {
   TypedSlotSet set(0);
   // These two constants must be static as a workaround
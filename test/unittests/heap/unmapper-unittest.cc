@@ -11,6 +11,7 @@
 #include "src/heap/memory-allocator.h"
 #include "src/heap/spaces-inl.h"
 #include "src/utils/ostreams.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -432,6 +433,67 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(page->address(), page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+// With --huge-pages, pooled pages stay committed so that the huge pages backing
+// them are not split, and old space pages are pooled as well.
+TEST_F(SequentialUnmapperTest, HugePagesKeepPooledPagesCommitted) {
+  if (v8_flags.enable_third_party_heap) return;
+  FLAG_SCOPE(huge_pages);
+  unmapper()->SetMaxCommittedPooledChunks(1);
+  PagedSpace* old_space = static_cast<PagedSpace*>(heap()->old_space());
+  Page* page = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kRegular, old_space,
+      Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const Address address = page->address();
+  const size_t page_size = tracking_page_allocator()->AllocatePageSize();
+  allocator()->Free(MemoryAllocator::FreeMode::kConcurrently, page);
+  unmapper()->FreeQueuedChunks();
+  tracking_page_allocator()->CheckPagePermissions(address, page_size,
+                                                  PageAllocator::kReadWrite);
+
+  // The pooled page is reused for the next old space page.
+  Page* reused_page = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kRegular, old_space,
+      Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(address, reused_page->address());
+  allocator()->Free(MemoryAllocator::FreeMode::kImmediately, reused_page);
+  unmapper()->TearDown();
+}
+
+// Only a limited number of pooled pages stay committed with --huge-pages.
+TEST_F(SequentialUnmapperTest, HugePagesLimitCommittedPooledPages) {
+  if (v8_flags.enable_third_party_heap) return;
+  FLAG_SCOPE(huge_pages);
+  unmapper()->SetMaxCommittedPooledChunks(1);
+  PagedSpace* old_space = static_cast<PagedSpace*>(heap()->old_space());
+  Page* first = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kRegular, old_space,
+      Executability::NOT_EXECUTABLE);
+  Page* second = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kRegular, old_space,
+      Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, first);
+  EXPECT_NE(nullptr, second);
+  const Address first_address = first->address();
+  const Address second_address = second->address();
+  const size_t page_size = tracking_page_allocator()->AllocatePageSize();
+  allocator()->Free(MemoryAllocator::FreeMode::kConcurrently, first);
+  allocator()->Free(MemoryAllocator::FreeMode::kConcurrently, second);
+  unmapper()->FreeQueuedChunks();
+  // Queued pages are pooled in reverse order.
+  tracking_page_allocator()->CheckPagePermissions(second_address, page_size,
+                                                  PageAllocator::kReadWrite);
+  tracking_page_allocator()->CheckPagePermissions(
+      first_address, page_size, PageAllocator::kNoAccess, false);
+
+  // Lowering the limit, e.g. when the heap reduces its memory usage,
+  // uncommits the pooled pages right away.
+  unmapper()->SetMaxCommittedPooledChunks(0);
+  tracking_page_allocator()->CheckPagePermissions(
+      second_address, page_size, PageAllocator::kNoAccess, false);
+  unmapper()->TearDown();
+}
 #endif  // !V8_OS_FUCHSIA && !V8_ENABLE_SANDBOX
 
 }  // namespace internal
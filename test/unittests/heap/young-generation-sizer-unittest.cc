@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/young-generation-sizer.h"
+
+#include "src/flags/flags.h"
+#include "src/heap/heap.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr size_t kMinCapacity = 1 * MB;
+constexpr size_t kMaxCapacity = 64 * MB;
+constexpr double kMaxPauseMs = 5;
+
+size_t TargetCapacity(double allocation_throughput, double survival_ratio,
+                      double survived_speed) {
+  return YoungGenerationSizer::TargetCapacity(
+      allocation_throughput, survival_ratio, survived_speed, kMaxPauseMs,
+      4 * MB, kMinCapacity, kMaxCapacity);
+}
+
+}  // namespace
+
+TEST(YoungGenerationSizerTest, MaxSemiSpaceSize) {
+  EXPECT_EQ(Heap::DefaultMaxSemiSpaceSize(),
+            YoungGenerationSizer::MaxSemiSpaceSize(uint64_t{512} * MB));
+  EXPECT_EQ(128 * MB,
+            YoungGenerationSizer::MaxSemiSpaceSize(uint64_t{16} * GB));
+  EXPECT_EQ(256 * MB * Heap::kPointerMultiplier,
+            YoungGenerationSizer::MaxSemiSpaceSize(uint64_t{1024} * GB));
+}
+
+TEST(YoungGenerationSizerTest, TargetCapacity) {
+  FlagScope<int> interval(&v8_flags.adaptive_young_generation_gc_interval_ms,
+                          100);
+  // Without samples, the capacity stays as it is.
+  EXPECT_EQ(4 * MB, TargetCapacity(0, 0, 0));
+  EXPECT_EQ(4 * MB, TargetCapacity(100 * KB, 0.1, 0));
+  // Idle isolates shrink to the minimum.
+  EXPECT_EQ(kMinCapacity, TargetCapacity(500, 0.1, 1 * MB));
+  // New space absorbs 100ms of allocation, rounded up to pages.
+  EXPECT_EQ(10 * MB, TargetCapacity(100 * KB, 0, 1 * MB));
+  EXPECT_EQ(kMaxCapacity, TargetCapacity(1 * MB, 0, 1 * MB));
+  // Unless a young GC of a full new space would take longer than the pause
+  // target.
+  EXPECT_EQ(10 * MB, TargetCapacity(1 * MB, 0.5, 1 * MB));
+  EXPECT_EQ(kMinCapacity, TargetCapacity(1 * MB, 1, 100 * KB));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,173 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-string-scanner.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Long enough to cover the inline prefix, several AVX2 vectors and a scalar
+// tail.
+constexpr int kMaxLength = kJsonScanInlineLength + 4 * 32 + 7;
+
+template <typename Char>
+std::vector<Char> Filler(int length, Char filler) {
+  return std::vector<Char>(length, filler);
+}
+
+const uint8_t* FindTerminator(const uint8_t* start, const uint8_t* end) {
+  return FindJsonStringTerminator(start, end);
+}
+
+const uint16_t* FindTerminator(const uint16_t* start, const uint16_t* end) {
+  uint16_t bits = 0;
+  return FindJsonStringTerminator(start, end, &bits);
+}
+
+// Checks that |stop| is found at every position of strings of every length
+// up to kMaxLength, for the given search function.
+template <typename Char, typename Search>
+void CheckStopAtEveryOffset(Char filler, Char stop, Search search) {
+  for (int length = 1; length <= kMaxLength; length++) {
+    for (int offset = 0; offset < length; offset++) {
+      std::vector<Char> chars = Filler(length, filler);
+      chars[offset] = stop;
+      const Char* start = chars.data();
+      EXPECT_EQ(start + offset, search(start, start + length))
+          << "length " << length << ", offset " << offset << ", stop "
+          << static_cast<int>(stop);
+    }
+  }
+}
+
+// Checks that no character is found in strings consisting only of |filler|,
+// including strings ending exactly at a vector boundary.
+template <typename Char, typename Search>
+void CheckNoStop(Char filler, Search search) {
+  for (int length = 0; length <= kMaxLength; length++) {
+    std::vector<Char> chars = Filler(length, filler);
+    const Char* start = chars.data();
+    EXPECT_EQ(start + length, search(start, start + length))
+        << "length " << length;
+  }
+}
+
+}  // namespace
+
+TEST(JsonStringScannerTest, OneByteTerminators) {
+  auto search = [](const uint8_t* start, const uint8_t* end) {
+    return FindTerminator(start, end);
+  };
+  static const uint8_t kStops[] = {'"', '\\', 0x00, 0x0A, 0x1F};
+  for (uint8_t stop : kStops) {
+    CheckStopAtEveryOffset<uint8_t>('a', stop, search);
+  }
+  CheckNoStop<uint8_t>('a', search);
+  // Non-ASCII Latin1 characters and the characters just outside the control
+  // range don't terminate a string.
+  CheckNoStop<uint8_t>(0x20, search);
+  CheckNoStop<uint8_t>(0x7F, search);
+  CheckNoStop<uint8_t>(0xE9, search);
+  CheckNoStop<uint8_t>(0xFF, search);
+  CheckStopAtEveryOffset<uint8_t>(0xFF, '"', search);
+}
+
+TEST(JsonStringScannerTest, TwoByteTerminators) {
+  auto search = [](const uint16_t* start, const uint16_t* end) {
+    return FindTerminator(start, end);
+  };
+  static const uint16_t kStops[] = {'"', '\\', 0x00, 0x0A, 0x1F};
+  for (uint16_t stop : kStops) {
+    CheckStopAtEveryOffset<uint16_t>('a', stop, search);
+    CheckStopAtEveryOffset<uint16_t>(0x4E2D, stop, search);
+  }
+  CheckNoStop<uint16_t>('a', search);
+  // Neither the high byte of a two-byte character, nor a surrogate, nor
+  // characters whose low byte looks like a terminator stop the scan.
+  CheckNoStop<uint16_t>(0x0122, search);
+  CheckNoStop<uint16_t>(0x225C, search);
+  CheckNoStop<uint16_t>(0x0100, search);
+  CheckNoStop<uint16_t>(0xD800, search);
+  CheckNoStop<uint16_t>(0xFFFF, search);
+}
+
+TEST(JsonStringScannerTest, TwoByteTerminatorBits) {
+  for (int length = 1; length <= kMaxLength; length++) {
+    for (int offset = 0; offset < length; offset++) {
+      // Only the character at |offset| is outside of Latin1. It must be
+      // reported in the bits iff it is before the terminator.
+      std::vector<uint16_t> chars = Filler<uint16_t>(length + 1, 'a');
+      chars[offset] = 0x4E2D;
+      for (int terminator = 0; terminator <= length; terminator++) {
+        if (terminator == offset) continue;
+        std::vector<uint16_t> copy = chars;
+        copy[terminator] = '"';
+        uint16_t bits = 0;
+        const uint16_t* start = copy.data();
+        EXPECT_EQ(start + terminator,
+                  FindJsonStringTerminator(start, start + length + 1, &bits));
+        EXPECT_EQ(offset < terminator, (bits & 0xFF00) != 0)
+            << "length " << length << ", offset " << offset << ", terminator "
+            << terminator;
+      }
+    }
+  }
+}
+
+TEST(JsonStringScannerTest, OneByteEscapes) {
+  auto search = [](const uint8_t* start, const uint8_t* end) {
+    return FindJsonEscapeCharacter(start, end);
+  };
+  static const uint8_t kStops[] = {'"', '\\', 0x00, 0x08, 0x1F};
+  for (uint8_t stop : kStops) {
+    CheckStopAtEveryOffset<uint8_t>('a', stop, search);
+  }
+  CheckNoStop<uint8_t>('a', search);
+  CheckNoStop<uint8_t>(0x7F, search);
+  CheckNoStop<uint8_t>(0xD8, search);
+  CheckNoStop<uint8_t>(0xFF, search);
+}
+
+TEST(JsonStringScannerTest, TwoByteEscapes) {
+  auto search = [](const uint16_t* start, const uint16_t* end) {
+    return FindJsonEscapeCharacter(start, end);
+  };
+  static const uint16_t kStops[] = {'"', '\\', 0x00, 0x08, 0x1F,
+                                    0xD800, 0xDBFF, 0xDC00, 0xDFFF};
+  for (uint16_t stop : kStops) {
+    CheckStopAtEveryOffset<uint16_t>('a', stop, search);
+    CheckStopAtEveryOffset<uint16_t>(0x4E2D, stop, search);
+  }
+  CheckNoStop<uint16_t>('a', search);
+  CheckNoStop<uint16_t>(0xD7FF, search);
+  CheckNoStop<uint16_t>(0xE000, search);
+  CheckNoStop<uint16_t>(0x225C, search);
+  CheckNoStop<uint16_t>(0xFFFF, search);
+}
+
+TEST(JsonStringScannerTest, UnalignedStart) {
+  // Start the search at every offset into a buffer, so that vector loads are
+  // not aligned to the vector size.
+  std::vector<uint8_t> one_byte = Filler<uint8_t>(kMaxLength, 'a');
+  std::vector<uint16_t> two_byte = Filler<uint16_t>(kMaxLength, 'a');
+  one_byte.back() = '"';
+  two_byte.back() = '\\';
+  for (int start = 0; start < kMaxLength; start++) {
+    const uint8_t* one_byte_end = one_byte.data() + kMaxLength;
+    EXPECT_EQ(one_byte_end - 1,
+              FindJsonStringTerminator(one_byte.data() + start, one_byte_end));
+    const uint16_t* two_byte_end = two_byte.data() + kMaxLength;
+    EXPECT_EQ(two_byte_end - 1,
+              FindJsonEscapeCharacter(two_byte.data() + start, two_byte_end));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
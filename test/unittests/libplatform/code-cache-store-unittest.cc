@@ -0,0 +1,102 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/libplatform/code-cache-store.h"
+
+#include <string.h>
+
+#include <memory>
+#include <string>
+
+#include "src/base/platform/platform.h"
+#include "src/libplatform/default-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace code_cache_store_unittest {
+
+namespace {
+
+// Keys are unique per process, so that tests running in parallel don't share
+// entries in the temporary directory.
+CodeCacheStore::Key MakeKey(const char* source) {
+  return {CodeCacheStore::HashSource(source, strlen(source)),
+          static_cast<uint32_t>(strlen(source)),
+          static_cast<uint32_t>(base::OS::GetCurrentProcessId())};
+}
+
+std::string ToString(const CodeCacheStore::Entry& entry) {
+  return std::string(reinterpret_cast<const char*>(entry.data()),
+                     entry.length());
+}
+
+void Store(CodeCacheStore* store, const CodeCacheStore::Key& key,
+           const std::string& data) {
+  store->Store(key, reinterpret_cast<const uint8_t*>(data.data()),
+               data.size());
+}
+
+}  // namespace
+
+TEST(CodeCacheStoreTest, HashSource) {
+  const char kSource[] = "function foo() { return 42; }";
+  EXPECT_EQ(CodeCacheStore::HashSource(kSource, strlen(kSource)),
+            CodeCacheStore::HashSource(kSource, strlen(kSource)));
+  // Every byte matters, including those in the tail that doesn't fill a word.
+  for (size_t i = 0; i < strlen(kSource); i++) {
+    std::string changed(kSource);
+    changed[i] ^= 1;
+    EXPECT_NE(CodeCacheStore::HashSource(kSource, strlen(kSource)),
+              CodeCacheStore::HashSource(changed.data(), changed.size()));
+  }
+  EXPECT_NE(CodeCacheStore::HashSource(kSource, strlen(kSource)),
+            CodeCacheStore::HashSource(kSource, strlen(kSource) - 1));
+}
+
+TEST(CodeCacheStoreTest, StoreLookupRemove) {
+  DefaultPlatform platform(2);
+  std::unique_ptr<CodeCacheStore> store =
+      NewCodeCacheStore(&platform, testing::TempDir().c_str());
+  CodeCacheStore::Key key = MakeKey("a script");
+  EXPECT_EQ(nullptr, store->Lookup(key));
+
+  Store(store.get(), key, "some code cache");
+  store->WaitForPendingWrites();
+  std::unique_ptr<CodeCacheStore::Entry> entry = store->Lookup(key);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("some code cache", ToString(*entry));
+
+  // Entries are replaced, and existing mappings stay valid.
+  Store(store.get(), key, "another code cache");
+  store->WaitForPendingWrites();
+  EXPECT_EQ("another code cache", ToString(*store->Lookup(key)));
+  EXPECT_EQ("some code cache", ToString(*entry));
+
+  // Other version tags don't see the entry.
+  CodeCacheStore::Key other_key = key;
+  other_key.version_tag++;
+  EXPECT_EQ(nullptr, store->Lookup(other_key));
+
+  store->Remove(key);
+  EXPECT_EQ(nullptr, store->Lookup(key));
+}
+
+TEST(CodeCacheStoreTest, PersistsAcrossStores) {
+  DefaultPlatform platform(2);
+  CodeCacheStore::Key key = MakeKey("another script");
+  NewCodeCacheStore(&platform, testing::TempDir().c_str())
+      ->Store(key, reinterpret_cast<const uint8_t*>("cache"), 5);
+  // Destroying the store finished the write.
+  std::unique_ptr<CodeCacheStore> store =
+      NewCodeCacheStore(&platform, testing::TempDir().c_str());
+  std::unique_ptr<CodeCacheStore::Entry> entry = store->Lookup(key);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("cache", ToString(*entry));
+  store->Remove(key);
+}
+
+}  // namespace code_cache_store_unittest
+}  // namespace platform
+}  // namespace v8
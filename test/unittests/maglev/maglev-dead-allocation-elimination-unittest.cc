@@ -0,0 +1,126 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevDeadAllocationEliminationTest : public TestWithContext {
+ public:
+  static void SetUpTestSuite() {
+    v8_flags.allow_natives_syntax = true;
+    v8_flags.maglev = true;
+    v8_flags.maglev_dead_allocation_elimination = true;
+    // Keep the driver loops below in the interpreter, so that the only
+    // allocations they observe are the ones made by the Maglev code.
+    v8_flags.use_osr = false;
+    TestWithContext::SetUpTestSuite();
+  }
+
+ protected:
+  static constexpr int kIterations = 1000;
+
+  // Maglev-compiles the function `name` (which takes a single Smi argument)
+  // and returns the number of bytes allocated in the young generation while
+  // calling it kIterations times.
+  size_t YoungBytesAllocatedByOptimizedCalls(const char* name) {
+    base::EmbeddedVector<char, 512> source;
+    base::SNPrintF(source,
+                   "%%PrepareFunctionForOptimization(%s);"
+                   "%s(1); %s(2);"
+                   "%%OptimizeMaglevOnNextCall(%s);"
+                   "%s(3);",
+                   name, name, name, name, name);
+    RunJS(source.begin());
+    base::SNPrintF(source, "%%ActiveTierIsMaglev(%s)", name);
+    CHECK(RunJS(source.begin())->IsTrue());
+
+    base::SNPrintF(source,
+                   "(function() {"
+                   "  for (let i = 0; i < %d; i++) %s(i);"
+                   "})",
+                   kIterations, name);
+    Local<Function> driver = RunJS(source.begin()).As<Function>();
+
+    Heap* heap = i_isolate()->heap();
+    size_t before = heap->NewSpaceAllocationCounter();
+    CHECK(!driver->Call(context(), context()->Global(), 0, nullptr).IsEmpty());
+    size_t after = heap->NewSpaceAllocationCounter();
+    return after - before;
+  }
+};
+
+TEST_F(MaglevDeadAllocationEliminationTest, DeadObjectLiteralIsNotAllocated) {
+  RunJS(
+      "function dead(x) {"
+      "  let o = {a: x, b: x, c: {d: x}};"
+      "  return x + 1;"
+      "}"
+      "function escaping(x) {"
+      "  let o = {a: x, b: x, c: {d: x}};"
+      "  return o;"
+      "}");
+
+  size_t escaping_bytes = YoungBytesAllocatedByOptimizedCalls("escaping");
+  // Sanity check that the measurement sees the allocations at all.
+  EXPECT_GE(escaping_bytes, kIterations * 2 * JSObject::kHeaderSize);
+
+  size_t dead_bytes = YoungBytesAllocatedByOptimizedCalls("dead");
+  // Less than a single word per call: the literals are gone.
+  EXPECT_LT(dead_bytes, kIterations * kTaggedSize);
+}
+
+TEST_F(MaglevDeadAllocationEliminationTest, DeadArrayLiteralIsNotAllocated) {
+  RunJS(
+      "function dead(x) {"
+      "  let a = [x, x, x];"
+      "  return x;"
+      "}");
+
+  size_t dead_bytes = YoungBytesAllocatedByOptimizedCalls("dead");
+  EXPECT_LT(dead_bytes, kIterations * kTaggedSize);
+}
+
+TEST_F(MaglevDeadAllocationEliminationTest,
+       ObjectStoredIntoDeadObjectIsNotAllocated) {
+  RunJS(
+      "function dead(x) {"
+      "  let inner = {v: x};"
+      "  let outer = {inner: inner};"
+      "  return x;"
+      "}");
+
+  size_t dead_bytes = YoungBytesAllocatedByOptimizedCalls("dead");
+  EXPECT_LT(dead_bytes, kIterations * kTaggedSize);
+}
+
+TEST_F(MaglevDeadAllocationEliminationTest, ObjectInFrameStateIsKept) {
+  // `o` is read back after the eager deopt point of the addition, and is
+  // part of that deopt point's frame state. Either use keeps it allocated.
+  RunJS(
+      "function live(x) {"
+      "  let o = {a: x};"
+      "  let y = x + 1;"
+      "  return o.a + y;"
+      "}");
+
+  size_t live_bytes = YoungBytesAllocatedByOptimizedCalls("live");
+  EXPECT_GE(live_bytes, kIterations * JSObject::kHeaderSize);
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV